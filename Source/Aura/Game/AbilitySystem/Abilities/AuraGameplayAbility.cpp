@@ -3,3 +3,38 @@
 
 #include "Game/AbilitySystem/Abilities/AuraGameplayAbility.h"
 
+#include "Game/AuraAssetManager.h"
+
+FPrimaryAssetId UAuraGameplayAbility::GetPrimaryAssetId() const
+{
+	if (HasAnyFlags(RF_ClassDefaultObject) && !GetClass()->HasAnyClassFlags(CLASS_Native))
+	{
+		return FPrimaryAssetId(UAuraAssetManager::AbilityAssetType, FPackageName::GetShortFName(GetOutermost()->GetFName()));
+	}
+
+	return FPrimaryAssetId();
+}
+
+void UAuraGameplayAbility::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const
+{
+}
+
+void UAuraGameplayAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
+	const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo,
+	const FGameplayEventData* TriggerEventData)
+{
+#if !UE_BUILD_SHIPPING
+	TArray<FSoftObjectPath> L_AssetsToPreload;
+	GetAssetsToPreload(L_AssetsToPreload);
+	for (const FSoftObjectPath& AssetPath : L_AssetsToPreload)
+	{
+		if (!AssetPath.IsNull() && AssetPath.ResolveObject() == nullptr)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: %s is not loaded at activation and will be loaded on the game thread. Preload it through GetAssetsToPreload."),
+				*GetName(), *AssetPath.ToString());
+		}
+	}
+#endif
+
+	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
+}
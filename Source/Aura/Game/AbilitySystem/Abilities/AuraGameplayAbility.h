@@ -23,4 +23,28 @@ public:
 	 */
 	UPROPERTY(EditDefaultsOnly, Category = "Input")
 	FGameplayTag StartupInputTag;
+
+	/**
+	 * @brief Identifies blueprint abilities as primary assets of type UAuraAssetManager::AbilityAssetType.
+	 *
+	 * Only the default object of a blueprint ability class has an id, native classes and instances do not.
+	 */
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	/**
+	 * @brief Collects the soft referenced assets this ability needs when it is activated.
+	 *
+	 * Characters preload these together with their startup abilities, so that the first activation does not load
+	 * anything on the game thread. Derived classes append to OutAssets and call the parent.
+	 *
+	 * @param OutAssets The list the soft paths are appended to.
+	 */
+	virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const;
+
+protected:
+	/**
+	 * Warns outside of shipping builds when an asset returned by GetAssetsToPreload is not resident yet at activation,
+	 * since the ability is then about to load it synchronously and hitch the game thread.
+	 */
+	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
 };
@@ -6,6 +6,12 @@
 #include "Game/Interaction/CombatInterface.h"
 #include "ProjectileActor/AuraProjectile.h"
 
+void UAuraProjectileSpell::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const
+{
+	Super::GetAssetsToPreload(OutAssets);
+
+	OutAssets.Add(ProjectileClass.ToSoftObjectPath());
+}
 
 void UAuraProjectileSpell::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
                                            const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo,
@@ -15,6 +21,8 @@ void UAuraProjectileSpell::ActivateAbility(const FGameplayAbilitySpecHandle Hand
 
 	if (HasAuthority(&ActivationInfo))
 	{
+		// Resident once the owning character finished its preload, in which case this does not load anything.
+		const TSubclassOf<AAuraProjectile> L_ProjectileClass = ProjectileClass.LoadSynchronous();
 		if (ICombatInterface* CombatInterface = Cast<ICombatInterface>(GetAvatarActorFromActorInfo()))
 		{
 			const FVector SocketLocation = CombatInterface->GetCombatSocketLocation();
@@ -23,7 +31,7 @@ void UAuraProjectileSpell::ActivateAbility(const FGameplayAbilitySpecHandle Hand
 			// TODO: Set the Projectile Rotation
 
 			AAuraProjectile* AuraProjectile = GetWorld()->SpawnActorDeferred<AAuraProjectile>(
-				ProjectileClass,
+				L_ProjectileClass,
 				Transform,
 				GetOwningActorFromActorInfo(),
 				Cast<APawn>(GetOwningActorFromActorInfo()),
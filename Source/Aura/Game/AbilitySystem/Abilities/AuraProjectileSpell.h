@@ -7,16 +7,22 @@
 #include "AuraProjectileSpell.generated.h"
 
 /**
- * 
+ * @class UAuraProjectileSpell
+ * @brief Ability that spawns a projectile from the avatar's combat socket.
+ *
+ * The projectile class is a soft reference, preloaded together with the ability through GetAssetsToPreload.
  */
 UCLASS()
 class AURA_API UAuraProjectileSpell : public UAuraGameplayAbility
 {
 	GENERATED_BODY()
 
+public:
+	virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssets) const override;
+
 protected:
 	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AuraProjectileSpell")
-	TSubclassOf<class AAuraProjectile> ProjectileClass = nullptr;
+	TSoftClassPtr<class AAuraProjectile> ProjectileClass = nullptr;
 };
@@ -6,58 +6,86 @@
 #include "AbilitySystemBlueprintLibrary.h"
 #include "GameplayEffectExtension.h"
 #include "Game/AuraGameplayTags.h"
+#include "Game/Characters/PlayerController/AuraPlayerController.h"
 #include "GameFramework/Character.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Math/UnrealMathUtility.h"
 
-UAuraAttributeSet::UAuraAttributeSet()
+FGameplayAttribute UAuraAttributeSet::GetAttributeForTag(EAuraGameplayTag AttributeTag)
 {
-	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+	const TStaticFuncPtr<FGameplayAttribute()> L_GetAttribute = FindAttributeGetter(AttributeTag);
+	return L_GetAttribute != nullptr ? L_GetAttribute() : FGameplayAttribute();
+}
 
-	/* Primary Attributes */
-	TagsToAttributes.Add(GameplayTags.Attributes_Primary_Strength, GetStrengthAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Primary_Intelligence, GetIntelligenceAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Primary_Resilience, GetResilienceAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Primary_Vigor, GetVigorAttribute);
-	
-	/* Secondary Attributes */
-	TagsToAttributes.Add(GameplayTags.Attributes_Secondary_Armor, GetArmorAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Secondary_ArmorPenetration, GetArmorPenetrationAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Secondary_BlockChance, GetBlockChanceAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Secondary_CriticalHitChance, GetCriticalHitChanceAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Secondary_CriticalHitDamage, GetCriticalHitDamageAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Secondary_CriticalHitResistance, GetCriticalHitResistanceAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Secondary_HealthRegeneration, GetHealthRegenerationAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Secondary_ManaRegeneration, GetManaRegenerationAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Secondary_MaxHealth, GetMaxHealthAttribute);
-	TagsToAttributes.Add(GameplayTags.Attributes_Secondary_MaxMana, GetMaxManaAttribute);
+TStaticFuncPtr<FGameplayAttribute()> UAuraAttributeSet::FindAttributeGetter(EAuraGameplayTag AttributeTag)
+{
+	struct FAttributeGetters
+	{
+		TStaticFuncPtr<FGameplayAttribute()> Getters[NumAttributeRows] = {};
+
+		FAttributeGetters()
+		{
+			/* Primary Attributes */
+			Set(EAuraGameplayTag::Attributes_Primary_Strength, GetStrengthAttribute);
+			Set(EAuraGameplayTag::Attributes_Primary_Intelligence, GetIntelligenceAttribute);
+			Set(EAuraGameplayTag::Attributes_Primary_Resilience, GetResilienceAttribute);
+			Set(EAuraGameplayTag::Attributes_Primary_Vigor, GetVigorAttribute);
+
+			/* Secondary Attributes */
+			Set(EAuraGameplayTag::Attributes_Secondary_Armor, GetArmorAttribute);
+			Set(EAuraGameplayTag::Attributes_Secondary_ArmorPenetration, GetArmorPenetrationAttribute);
+			Set(EAuraGameplayTag::Attributes_Secondary_BlockChance, GetBlockChanceAttribute);
+			Set(EAuraGameplayTag::Attributes_Secondary_CriticalHitChance, GetCriticalHitChanceAttribute);
+			Set(EAuraGameplayTag::Attributes_Secondary_CriticalHitDamage, GetCriticalHitDamageAttribute);
+			Set(EAuraGameplayTag::Attributes_Secondary_CriticalHitResistance, GetCriticalHitResistanceAttribute);
+			Set(EAuraGameplayTag::Attributes_Secondary_HealthRegeneration, GetHealthRegenerationAttribute);
+			Set(EAuraGameplayTag::Attributes_Secondary_ManaRegeneration, GetManaRegenerationAttribute);
+			Set(EAuraGameplayTag::Attributes_Secondary_MaxHealth, GetMaxHealthAttribute);
+			Set(EAuraGameplayTag::Attributes_Secondary_MaxMana, GetMaxManaAttribute);
+		}
+
+		void Set(EAuraGameplayTag Tag, TStaticFuncPtr<FGameplayAttribute()> GetAttribute)
+		{
+			Getters[static_cast<int32>(Tag) - FirstAttributeRow] = GetAttribute;
+		}
+	};
+	static const FAttributeGetters AttributeGetters;
+
+	const int32 L_Row = static_cast<int32>(AttributeTag) - FirstAttributeRow;
+	return L_Row >= 0 && L_Row < NumAttributeRows ? AttributeGetters.Getters[L_Row] : nullptr;
 }
 
 void UAuraAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
+	FDoRepLifetimeParams L_Params;
+	L_Params.Condition = COND_None;
+	L_Params.RepNotifyCondition = REPNOTIFY_Always;
+	L_Params.bIsPushBased = true;
+
 	// Primary Attributes
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Vigor, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Strength, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Resilience, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Intelligence, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Vigor, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Strength, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Resilience, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Intelligence, L_Params);
 
 	// Secondary Attributes
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Armor, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, MaxMana, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, MaxHealth, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, BlockChance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, ManaRegeneration, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, ArmorPenetration, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, CriticalHitChance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, CriticalHitDamage, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, HealthRegeneration, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, CriticalHitResistance, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Armor, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, MaxMana, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, MaxHealth, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, BlockChance, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, ManaRegeneration, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, ArmorPenetration, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, CriticalHitChance, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, CriticalHitDamage, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, HealthRegeneration, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, CriticalHitResistance, L_Params);
 
 	// Vital Attributes
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Mana, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Health, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Mana, L_Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Health, L_Params);
 }
 
 void UAuraAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
@@ -74,6 +102,13 @@ void UAuraAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute,
 	}
 }
 
+bool UAuraAttributeSet::PreGameplayEffectExecute(FGameplayEffectModCallbackData& Data)
+{
+	HealthBeforeExecute = GetHealth();
+
+	return Super::PreGameplayEffectExecute(Data);
+}
+
 void UAuraAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
 	Super::PostGameplayEffectExecute(Data);
@@ -87,6 +122,13 @@ void UAuraAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallba
 		const float L_MaxHealth = GetMaxHealth();
 		const float L_ClampValue = FMath::Clamp(L_Health, 0.f, L_MaxHealth);
 		SetHealth(L_ClampValue);
+
+		// Overrides are initialization and never shown. The magnitude of an additive modifier is not clamped, so the
+		// clamped change is shown instead: nothing for a heal at full health, at most the remaining health for damage.
+		if (Data.EvaluatedData.ModifierOp == EGameplayModOp::Additive)
+		{
+			ShowCombatText(Props, L_ClampValue - HealthBeforeExecute);
+		}
 	}
 	if (Data.EvaluatedData.Attribute == GetManaAttribute())
 	{
@@ -97,6 +139,27 @@ void UAuraAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallba
 	}
 }
 
+void UAuraAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue)
+{
+	Super::PostAttributeChange(Attribute, OldValue, NewValue);
+
+	if (OldValue != NewValue)
+	{
+		MARK_PROPERTY_DIRTY(this, Attribute.GetUProperty());
+	}
+}
+
+void UAuraAttributeSet::PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const
+{
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+
+	// The base value replicates inside the same FGameplayAttributeData as the current value.
+	if (OldValue != NewValue)
+	{
+		MARK_PROPERTY_DIRTY(this, Attribute.GetUProperty());
+	}
+}
+
 void UAuraAttributeSet::SetEffectProperties(const FGameplayEffectModCallbackData& Data, FEffectProperties& Props) const
 {
 	Props.EffectContextHandle = Data.EffectSpec.GetContext();
@@ -130,6 +193,25 @@ void UAuraAttributeSet::SetEffectProperties(const FGameplayEffectModCallbackData
 	}
 }
 
+void UAuraAttributeSet::ShowCombatText(const FEffectProperties& Props, float Amount) const
+{
+	if (FMath::IsNearlyZero(Amount) || !IsValid(Props.TargetAvatarActor))
+	{
+		return;
+	}
+
+	AAuraPlayerController* L_SourcePC = Cast<AAuraPlayerController>(Props.SourceController);
+	if (IsValid(L_SourcePC))
+	{
+		L_SourcePC->Client_ShowCombatText(Props.TargetAvatarActor, Amount);
+	}
+
+	if (AAuraPlayerController* L_TargetPC = Cast<AAuraPlayerController>(Props.TargetController); IsValid(L_TargetPC) && L_TargetPC != L_SourcePC)
+	{
+		L_TargetPC->Client_ShowCombatText(Props.TargetAvatarActor, Amount);
+	}
+}
+
 void UAuraAttributeSet::OnRep_Health(const FGameplayAttributeData& OldHealth) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, Health, OldHealth);
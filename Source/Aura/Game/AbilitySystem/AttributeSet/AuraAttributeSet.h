@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "AttributeSet.h"
 #include "AbilitySystemComponent.h"
+#include "Game/AuraGameplayTags.h"
 #include "AuraAttributeSet.generated.h"
 
 #define ATTRIBUTE_ACCESSORS(ClassName, PropertyName) \
@@ -125,8 +126,8 @@ template<class T>
 using TStaticFuncPtr = TBaseStaticDelegateInstance<FGameplayAttribute(), FDefaultTSDelegateUserPolicy>::FFuncPtr;
 
 /**
- * Initializes a new instance of the UAuraAttributeSet class.
- * This constructor sets up default values and configurations.
+ * The primary, secondary and vital attributes of Aura characters. The primary and secondary attributes can be looked
+ * up by their native gameplay tag through GetAttributeForTag.
  */
 UCLASS()
 class AURA_API UAuraAttributeSet : public UAttributeSet
@@ -134,15 +135,10 @@ class AURA_API UAuraAttributeSet : public UAttributeSet
 	GENERATED_BODY()
 
 public:
-	/**
-	 * UAuraAttributeSet constructor. Initializes the TagsToAttributes map with primary and secondary attribute tags.
-	 *
-	 * @return A constructed instance of UAuraAttributeSet with predefined gameplay tags mapped to corresponding attribute getter functions.
-	 */
-	UAuraAttributeSet();
-
 	/**
 	 * Populates the list of properties that require network replication for this attribute set.
+	 * Every attribute is push based, the net driver only compares it after it was marked dirty in PostAttributeChange
+	 * or PostAttributeBaseChange.
 	 *
 	 * @param OutLifetimeProps The array that will be populated with the properties to replicate.
 	 */
@@ -157,6 +153,15 @@ public:
 	 */
 	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
 
+	/**
+	 * Records the health before a gameplay effect executes, so PostGameplayEffectExecute can report the health that
+	 * was actually gained or lost.
+	 *
+	 * @param Data Callback data containing details about the gameplay effect execution.
+	 * @return Always true, the execution is never skipped.
+	 */
+	virtual bool PreGameplayEffectExecute(FGameplayEffectModCallbackData& Data) override;
+
 	/**
 	 * Handles the modifications applied by a gameplay effect after it has been executed.
 	 * Clamps health and mana attributes to ensure they remain within valid ranges.
@@ -166,15 +171,48 @@ public:
 	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
 
 	/**
-	 * A mapping between gameplay tags and corresponding static function pointers that return gameplay attributes.
+	 * Marks the replicated property of the attribute dirty when its current value changed.
+	 *
+	 * @param Attribute The attribute that changed.
+	 * @param OldValue The current value before the change.
+	 * @param NewValue The current value after the change.
+	 */
+	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
+
+	/**
+	 * Marks the replicated property of the attribute dirty when its base value changed.
+	 *
+	 * @param Attribute The attribute that changed.
+	 * @param OldValue The base value before the change.
+	 * @param NewValue The base value after the change.
+	 */
+	virtual void PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const override;
+
+	/**
+	 * @brief Returns the attribute a native attribute tag stands for.
 	 *
-	 * This map facilitates the association of specific gameplay tags with functions that yield the corresponding
-	 * FGameplayAttribute, allowing for dynamic and flexible attribute management based on tags.
+	 * The getters are stored in a flat array over the Attributes rows of AURA_NATIVE_GAMEPLAY_TAGS, so the lookup is
+	 * an index instead of a hash of the full tag.
 	 *
-	 * - Key: FGameplayTag representing a unique identifier for a category or type of gameplay element.
-	 * - Value: TStaticFuncPtr<FGameplayAttribute()> is a pointer to a static function that returns an FGameplayAttribute.
+	 * @param AttributeTag The Aura-local index of the attribute tag.
+	 * @return The attribute, invalid for tags that name no attribute, like Attributes.Primary.
 	 */
-	TMap<FGameplayTag, TStaticFuncPtr<FGameplayAttribute()>> TagsToAttributes;
+	static FGameplayAttribute GetAttributeForTag(EAuraGameplayTag AttributeTag);
+
+	/**
+	 * @brief Calls Func(EAuraGameplayTag, const FGameplayAttribute&) for every attribute that has a native tag, in table order.
+	 */
+	template<typename FuncType>
+	static void ForEachTaggedAttribute(FuncType&& Func)
+	{
+		for (int32 Row = FirstAttributeRow; Row < FirstAttributeRow + NumAttributeRows; ++Row)
+		{
+			if (const TStaticFuncPtr<FGameplayAttribute()> GetAttribute = FindAttributeGetter(static_cast<EAuraGameplayTag>(Row)))
+			{
+				Func(static_cast<EAuraGameplayTag>(Row), GetAttribute());
+			}
+		}
+	}
 
 	/**
 	 * Represents the Strength attribute for a character.
@@ -506,6 +544,18 @@ public:
 	void OnRep_Vigor(const FGameplayAttributeData& OldVigor) const;
 
 private:
+	/**
+	 * The first and the number of rows of AURA_NATIVE_GAMEPLAY_TAGS covered by the attribute getters.
+	 */
+	static constexpr int32 FirstAttributeRow = static_cast<int32>(EAuraGameplayTag::Attributes);
+	static constexpr int32 NumAttributeRows = static_cast<int32>(EAuraGameplayTag::Attributes_Secondary_MaxMana) - FirstAttributeRow + 1;
+
+	/**
+	 * Returns the getter of the attribute a native tag stands for, nullptr for tags outside the Attributes rows or
+	 * without an attribute.
+	 */
+	static TStaticFuncPtr<FGameplayAttribute()> FindAttributeGetter(EAuraGameplayTag AttributeTag);
+
 	/**
 	 * Sets the properties for a given effect.
 	 *
@@ -518,4 +568,20 @@ private:
 	 *                   and their corresponding values to be set for the effect.
 	 */
 	void SetEffectProperties(const FGameplayEffectModCallbackData& Data, FEffectProperties& Props) const;
+
+	/**
+	 * @brief Sends a health change as floating combat text to the players involved in the effect.
+	 *
+	 * Only the source and target player controllers are notified, each at most once, so other clients never
+	 * receive combat text for fights they are not part of.
+	 *
+	 * @param Props The resolved source and target of the executed effect.
+	 * @param Amount The health change. Negative values are damage, positive values are healing.
+	 */
+	void ShowCombatText(const FEffectProperties& Props, float Amount) const;
+
+	/**
+	 * The health before the gameplay effect currently executing, set by PreGameplayEffectExecute.
+	 */
+	float HealthBeforeExecute = 0.f;
 };
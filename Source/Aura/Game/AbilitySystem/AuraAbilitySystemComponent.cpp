@@ -9,6 +9,67 @@
 void UAuraAbilitySystemComponent::AbilityActorInfoSet()
 {
 	OnGameplayEffectAppliedDelegateToSelf.AddUObject(this, &UAuraAbilitySystemComponent::Client_EffectApplied);
+
+	if (IsOwnerActorAuthoritative() && !bReplicatedActivityEventsBound)
+	{
+		BindReplicatedActivityEvents();
+	}
+}
+
+void UAuraAbilitySystemComponent::BindReplicatedActivityEvents()
+{
+	bReplicatedActivityEventsBound = true;
+
+	OnGameplayEffectAppliedDelegateToSelf.AddWeakLambda(this,
+		[this](UAbilitySystemComponent*, const FGameplayEffectSpec&, FActiveGameplayEffectHandle) { OnReplicatedActivity.Broadcast(); });
+	OnAnyGameplayEffectRemovedDelegate().AddWeakLambda(this,
+		[this](const FActiveGameplayEffect&) { OnReplicatedActivity.Broadcast(); });
+	RegisterGenericGameplayTagEvent().AddWeakLambda(this,
+		[this](const FGameplayTag, int32) { OnReplicatedActivity.Broadcast(); });
+	AbilityActivatedCallbacks.AddWeakLambda(this,
+		[this](UGameplayAbility*) { OnReplicatedActivity.Broadcast(); });
+
+	for (const UAttributeSet* AttributeSet : GetSpawnedAttributes())
+	{
+		if (!IsValid(AttributeSet))
+		{
+			continue;
+		}
+
+		TArray<FGameplayAttribute> L_Attributes;
+		UAttributeSet::GetAttributesFromSetClass(AttributeSet->GetClass(), L_Attributes);
+		for (const FGameplayAttribute& Attribute : L_Attributes)
+		{
+			GetGameplayAttributeValueChangeDelegate(Attribute).AddWeakLambda(this,
+				[this](const FOnAttributeChangeData&) { OnReplicatedActivity.Broadcast(); });
+		}
+	}
+}
+
+void UAuraAbilitySystemComponent::AddLevelDependentEffect(FActiveGameplayEffectHandle EffectHandle)
+{
+	if (EffectHandle.IsValid())
+	{
+		LevelDependentEffects.AddUnique(EffectHandle);
+	}
+}
+
+void UAuraAbilitySystemComponent::RefreshLevelDependentEffects(int32 NewLevel)
+{
+	FScopedAggregatorOnDirtyBatch L_AggregatorBatch;
+
+	for (int32 Index = LevelDependentEffects.Num() - 1; Index >= 0; --Index)
+	{
+		const FActiveGameplayEffectHandle& EffectHandle = LevelDependentEffects[Index];
+		if (GetActiveGameplayEffect(EffectHandle) == nullptr)
+		{
+			LevelDependentEffects.RemoveAtSwap(Index);
+			continue;
+		}
+
+		// A new level recalculates the modifier magnitudes and updates the aggregators.
+		SetActiveGameplayEffectLevel(EffectHandle, NewLevel);
+	}
 }
 
 void UAuraAbilitySystemComponent::AddCharacterAbilities(TArray<TSubclassOf<UGameplayAbility>>& StartupAbilities)
@@ -24,14 +85,69 @@ void UAuraAbilitySystemComponent::AddCharacterAbilities(TArray<TSubclassOf<UGame
 	}
 }
 
+bool UAuraAbilitySystemComponent::AssignAbilityInputTag(FGameplayAbilitySpecHandle AbilitySpecHandle, const FGameplayTag& NewInputTag)
+{
+	const int32 L_AbilityIndex = ActivatableAbilities.Items.IndexOfByPredicate([&AbilitySpecHandle](const FGameplayAbilitySpec& Spec)
+	{
+		return Spec.Handle == AbilitySpecHandle;
+	});
+
+	if (L_AbilityIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	FGameplayAbilitySpec& AbilitySpec = ActivatableAbilities.Items[L_AbilityIndex];
+	FGameplayTagContainer& DynamicTags = AbilitySpec.GetDynamicSpecSourceTags();
+
+	TArray<FGameplayTag, TInlineAllocator<2>> L_OldInputTags;
+	for (const FGameplayTag& Tag : DynamicTags)
+	{
+		if (IsInputTag(Tag))
+		{
+			L_OldInputTags.Add(Tag);
+		}
+	}
+
+	for (const FGameplayTag& OldInputTag : L_OldInputTags)
+	{
+		DynamicTags.RemoveTag(OldInputTag);
+
+		if (!bInputTagIndexDirty)
+		{
+			if (TArray<int32>* L_Indices = AbilityIndicesByInputTag.Find(OldInputTag))
+			{
+				L_Indices->RemoveSingleSwap(L_AbilityIndex, EAllowShrinking::No);
+			}
+		}
+	}
+
+	if (NewInputTag.IsValid())
+	{
+		DynamicTags.AddTag(NewInputTag);
+
+		if (!bInputTagIndexDirty)
+		{
+			AbilityIndicesByInputTag.FindOrAdd(NewInputTag).AddUnique(L_AbilityIndex);
+		}
+	}
+
+	MarkAbilitySpecDirty(AbilitySpec);
+
+	return true;
+}
+
 void UAuraAbilitySystemComponent::AbilityInputTagHeld(const FGameplayTag& InInputTag)
 {
 	if (InInputTag.IsValid())
 	{
-		for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+		if (const TArray<int32>* L_Indices = FindAbilityIndicesForInputTag(InInputTag))
 		{
-			if (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InInputTag))
+			// Activating an ability may grant or remove others, the lock defers that until the loop is done.
+			ABILITYLIST_SCOPE_LOCK();
+			for (const int32 AbilityIndex : *L_Indices)
 			{
+				FGameplayAbilitySpec& AbilitySpec = ActivatableAbilities.Items[AbilityIndex];
 				AbilitySpecInputPressed(AbilitySpec);
 				if (!AbilitySpec.IsActive())
 				{
@@ -46,16 +162,74 @@ void UAuraAbilitySystemComponent::AbilityInputTagReleased(const FGameplayTag& In
 {
 	if (InInputTag.IsValid())
 	{
-		for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+		if (const TArray<int32>* L_Indices = FindAbilityIndicesForInputTag(InInputTag))
 		{
-			if (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InInputTag))
+			for (const int32 AbilityIndex : *L_Indices)
 			{
-				AbilitySpecInputReleased(AbilitySpec);
+				AbilitySpecInputReleased(ActivatableAbilities.Items[AbilityIndex]);
 			}
 		}
 	}
 }
 
+void UAuraAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+
+	bInputTagIndexDirty = true;
+}
+
+void UAuraAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnRemoveAbility(AbilitySpec);
+
+	bInputTagIndexDirty = true;
+}
+
+void UAuraAbilitySystemComponent::OnRep_ActivateAbilities()
+{
+	Super::OnRep_ActivateAbilities();
+
+	bInputTagIndexDirty = true;
+}
+
+const TArray<int32>* UAuraAbilitySystemComponent::FindAbilityIndicesForInputTag(const FGameplayTag& InInputTag)
+{
+	if (bInputTagIndexDirty)
+	{
+		RebuildInputTagIndex();
+	}
+
+	return AbilityIndicesByInputTag.Find(InInputTag);
+}
+
+void UAuraAbilitySystemComponent::RebuildInputTagIndex()
+{
+	for (TPair<FGameplayTag, TArray<int32>>& Pair : AbilityIndicesByInputTag)
+	{
+		Pair.Value.Reset();
+	}
+
+	const TArray<FGameplayAbilitySpec>& L_Abilities = ActivatableAbilities.Items;
+	for (int32 AbilityIndex = 0; AbilityIndex < L_Abilities.Num(); ++AbilityIndex)
+	{
+		for (const FGameplayTag& Tag : L_Abilities[AbilityIndex].GetDynamicSpecSourceTags())
+		{
+			if (IsInputTag(Tag))
+			{
+				AbilityIndicesByInputTag.FindOrAdd(Tag).Add(AbilityIndex);
+			}
+		}
+	}
+
+	bInputTagIndexDirty = false;
+}
+
+bool UAuraAbilitySystemComponent::IsInputTag(const FGameplayTag& Tag)
+{
+	return FAuraGameplayTags::MatchesTag(Tag, EAuraGameplayTag::InputTag);
+}
+
 void UAuraAbilitySystemComponent::Client_EffectApplied_Implementation(UAbilitySystemComponent* AbilitySystemComponent,
                                                 const FGameplayEffectSpec& EffectSpec, FActiveGameplayEffectHandle ActiveEffectHandle)
 {
@@ -63,4 +237,47 @@ void UAuraAbilitySystemComponent::Client_EffectApplied_Implementation(UAbilitySy
 	EffectSpec.GetAllAssetTags(TagContainer);
 
 	EffectAssetTags.Broadcast(TagContainer);
+
+	if (!SubscribedRouteRoots.IsEmpty())
+	{
+		RouteEffectAssetTags(TagContainer);
+	}
+}
+
+FDelegateHandle UAuraAbilitySystemComponent::SubscribeEffectAssetTags(EAuraGameplayTag RouteRoot, FEffectAssetTagRouted::FDelegate&& Subscriber)
+{
+	if (EffectAssetTagRoutes.Num() == 0)
+	{
+		EffectAssetTagRoutes.SetNum(FAuraGameplayTagBitSet::NumTags);
+	}
+
+	SubscribedRouteRoots.AddTag(RouteRoot);
+	return EffectAssetTagRoutes[static_cast<int32>(RouteRoot)].Add(MoveTemp(Subscriber));
+}
+
+void UAuraAbilitySystemComponent::UnsubscribeEffectAssetTags(EAuraGameplayTag RouteRoot, FDelegateHandle Handle)
+{
+	if (!EffectAssetTagRoutes.IsValidIndex(static_cast<int32>(RouteRoot)))
+	{
+		return;
+	}
+
+	FEffectAssetTagRouted& Route = EffectAssetTagRoutes[static_cast<int32>(RouteRoot)];
+	Route.Remove(Handle);
+	if (!Route.IsBound())
+	{
+		SubscribedRouteRoots.RemoveTag(RouteRoot);
+	}
+}
+
+void UAuraAbilitySystemComponent::RouteEffectAssetTags(const FGameplayTagContainer& AssetTags) const
+{
+	for (const FGameplayTag& AssetTag : AssetTags)
+	{
+		const FAuraGameplayTagBitSet L_Routes = FAuraGameplayTags::GetNativeAncestors(AssetTag) & SubscribedRouteRoots;
+		L_Routes.ForEachTag([this, &AssetTag](EAuraGameplayTag RouteRoot)
+		{
+			EffectAssetTagRoutes[static_cast<int32>(RouteRoot)].Broadcast(AssetTag);
+		});
+	}
 }
@@ -4,9 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "AbilitySystemComponent.h"
+#include "Game/AuraGameplayTags.h"
 #include "AuraAbilitySystemComponent.generated.h"
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FEffectAssetTags, const FGameplayTagContainer& /*AssetTags*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FEffectAssetTagRouted, const FGameplayTag& /*AssetTag*/);
+DECLARE_MULTICAST_DELEGATE(FOnReplicatedActivity);
 
 /**
  * @brief Custom ability system component for the Aura game.
@@ -35,6 +38,37 @@ public:
 	 */
 	FEffectAssetTags EffectAssetTags;
 
+	/**
+	 * @brief Broadcast on the server whenever state that replicates to clients changes.
+	 *
+	 * Fires on attribute changes, gameplay tag count changes, effect application and removal, and ability
+	 * activation. Owners use it to wake from net dormancy or raise their net update frequency while they are active.
+	 * Bound once AbilityActorInfoSet runs with authority, never broadcast on clients.
+	 */
+	FOnReplicatedActivity OnReplicatedActivity;
+
+	/**
+	 * @brief Subscribes to the asset tags of applied effects that fall under a native tag subtree.
+	 *
+	 * Unlike EffectAssetTags, the subscriber is only called for matching tags, once per tag, and does not have to scan
+	 * the container itself. Every asset tag is routed to all subscribed subtrees with a single lookup of its
+	 * precompiled native ancestors, see FAuraGameplayTags::GetNativeAncestors. Typical roots are Message for UI
+	 * messages, or buff and cue parents.
+	 *
+	 * @param RouteRoot The native parent tag of the subtree to receive.
+	 * @param Subscriber Called with each applied asset tag that matches RouteRoot.
+	 * @return A handle to pass to UnsubscribeEffectAssetTags.
+	 */
+	FDelegateHandle SubscribeEffectAssetTags(EAuraGameplayTag RouteRoot, FEffectAssetTagRouted::FDelegate&& Subscriber);
+
+	/**
+	 * @brief Removes a subscriber added with SubscribeEffectAssetTags.
+	 *
+	 * @param RouteRoot The root the subscriber was registered for.
+	 * @param Handle The handle returned by SubscribeEffectAssetTags.
+	 */
+	void UnsubscribeEffectAssetTags(EAuraGameplayTag RouteRoot, FDelegateHandle Handle);
+
 	/**
 	 * @brief Adds initial abilities to the character's ability system component.
 	 *
@@ -45,10 +79,45 @@ public:
 	 */
 	void AddCharacterAbilities(TArray<TSubclassOf<UGameplayAbility>>& StartupAbilities);
 
+	/**
+	 * @brief Registers an active effect whose level follows the level of the character.
+	 *
+	 * Only effects registered here are moved by RefreshLevelDependentEffects. Effects applied at an ability or item
+	 * level keep that level, even when they use a custom magnitude calculation. Only call with authority.
+	 *
+	 * @param EffectHandle The handle of the applied effect. Invalid handles are ignored.
+	 */
+	void AddLevelDependentEffect(FActiveGameplayEffectHandle EffectHandle);
+
+	/**
+	 * @brief Moves the effects registered with AddLevelDependentEffect to a new level.
+	 *
+	 * Magnitude calculations like UMMC_MaxHealth read the character level from the effect level, so changing the level
+	 * recalculates them. Every effect is moved inside a single aggregator batch, which evaluates each dependent
+	 * attribute once, however many effects touch it. Effects already at the level are left untouched, and effects
+	 * that were removed are forgotten. Only call with authority.
+	 *
+	 * @param NewLevel The new level of the character.
+	 */
+	void RefreshLevelDependentEffects(int32 NewLevel);
+
+	/**
+	 * @brief Moves a granted ability to another input tag.
+	 *
+	 * Replaces the input tags in the ability spec's dynamic source tags and only updates the affected entries of the
+	 * input tag index, so changing an ability slot mid-combat does not rebuild anything. Should be called with
+	 * authority; clients pick the change up when the ability spec replicates.
+	 *
+	 * @param AbilitySpecHandle The handle of the granted ability.
+	 * @param NewInputTag The input tag the ability should respond to. An empty tag removes the ability from all inputs.
+	 * @return True if the ability was found.
+	 */
+	bool AssignAbilityInputTag(FGameplayAbilitySpecHandle AbilitySpecHandle, const FGameplayTag& NewInputTag);
+
 	/**
 	 * @brief Handles the logic for when an ability input tag is held.
 	 *
-	 * This function checks if the provided input tag is valid and iterates through the activatable abilities.
+	 * This function checks if the provided input tag is valid and looks up the abilities bound to it in the input tag index.
 	 * If an ability matches the input tag and is not yet active, it attempts to activate the ability.
 	 *
 	 * @param InInputTag The gameplay tag representing the input held by the player.
@@ -58,14 +127,20 @@ public:
 	/**
 	 * @brief Handles the release of an input associated with a gameplay ability.
 	 *
-	 * This function is responsible for iterating through the activatable abilities and identifying those
-	 * that match the specified input tag. If a matching ability is found, the input release logic for that ability is executed.
+	 * This function is responsible for looking up the activatable abilities
+	 * that match the specified input tag in the input tag index. If a matching ability is found, the input release logic for that ability is executed.
 	 *
 	 * @param InInputTag The gameplay tag associated with the input that was released.
 	 */
 	void AbilityInputTagReleased(const FGameplayTag& InInputTag);
 	
 protected:
+	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+
+	virtual void OnRep_ActivateAbilities() override;
+
 	/**
 	 * @brief Notifies the client about an applied gameplay effect.
 	 *
@@ -79,4 +154,69 @@ protected:
 	 */
 	UFUNCTION(Client, Reliable)
 	void Client_EffectApplied(UAbilitySystemComponent* AbilitySystemComponent, const FGameplayEffectSpec& EffectSpec, FActiveGameplayEffectHandle ActiveEffectHandle);
+
+private:
+	/**
+	 * @brief Binds OnReplicatedActivity to the change events of the ability system. Only called once, with authority.
+	 */
+	void BindReplicatedActivityEvents();
+
+	/**
+	 * Whether BindReplicatedActivityEvents already ran.
+	 */
+	bool bReplicatedActivityEventsBound = false;
+
+	/**
+	 * @brief Calls the subscribers of every route root the given asset tags fall under.
+	 *
+	 * @param AssetTags The asset tags of an applied effect.
+	 */
+	void RouteEffectAssetTags(const FGameplayTagContainer& AssetTags) const;
+
+	/**
+	 * Route roots with at least one subscriber.
+	 */
+	FAuraGameplayTagBitSet SubscribedRouteRoots;
+
+	/**
+	 * Subscribers indexed by route root. Sized to all native tags on first subscription so that entries never move
+	 * while a route is being broadcast.
+	 */
+	TArray<FEffectAssetTagRouted> EffectAssetTagRoutes;
+
+	/**
+	 * @brief Returns the indices into the activatable abilities of the abilities bound to an input tag.
+	 *
+	 * Rebuilds the input tag index first if abilities were granted, removed or replicated since the last call.
+	 *
+	 * @param InInputTag The input tag to look up.
+	 * @return The indices, or nullptr if no ability is bound to the tag.
+	 */
+	const TArray<int32>* FindAbilityIndicesForInputTag(const FGameplayTag& InInputTag);
+
+	/**
+	 * @brief Rebuilds the input tag index from the activatable abilities.
+	 */
+	void RebuildInputTagIndex();
+
+	/**
+	 * @brief Returns whether a tag is an input tag, i.e. matches the "InputTag" parent.
+	 */
+	static bool IsInputTag(const FGameplayTag& Tag);
+
+	/**
+	 * Indices into ActivatableAbilities.Items of the abilities bound to each input tag.
+	 */
+	TMap<FGameplayTag, TArray<int32>> AbilityIndicesByInputTag;
+
+	/**
+	 * Set whenever the activatable abilities change, so the index is rebuilt once on the next input instead of
+	 * on every grant or removal.
+	 */
+	bool bInputTagIndexDirty = true;
+
+	/**
+	 * The active effects whose level follows the level of the character.
+	 */
+	TArray<FActiveGameplayEffectHandle> LevelDependentEffects;
 };
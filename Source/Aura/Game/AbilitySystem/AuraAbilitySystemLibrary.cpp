@@ -3,25 +3,13 @@
 
 #include "Game/AbilitySystem/AuraAbilitySystemLibrary.h"
 
-#include "Game/Characters/PlayerState/AuraPlayerState.h"
-#include "Game/UI/HUD/AuraHUD.h"
-#include "Game/UI/WidgetController/AuraWidgetController/AuraWidgetController.h"
-#include "Kismet/GameplayStatics.h"
+#include "Game/UI/WidgetController/AuraWidgetControllerSubsystem/AuraWidgetControllerSubsystem.h"
 
 UOverlayWidgetController* UAuraAbilitySystemLibrary::GetOverlayWidgetController(const UObject* WorldContextObject)
 {
-	if (APlayerController* PC = UGameplayStatics::GetPlayerController(WorldContextObject, 0); IsValid(PC))
+	if (UAuraWidgetControllerSubsystem* Subsystem = UAuraWidgetControllerSubsystem::Get(WorldContextObject))
 	{
-		if (AAuraHUD* AuraHUD = Cast<AAuraHUD>(PC->GetHUD()))
-		{
-			if (AAuraPlayerState* PS = PC->GetPlayerState<AAuraPlayerState>(); IsValid(PS))
-			{
-				UAbilitySystemComponent* ASC = PS->GetAbilitySystemComponent();
-				UAttributeSet* AS = PS->GetAttributeSet();
-				const FWidgetControllerParams WidgetControllerParams(PC, PS, ASC, AS);
-				return AuraHUD->GetOverlayWidgetController(WidgetControllerParams);
-			}
-		}
+		return Subsystem->GetOverlayWidgetController(WorldContextObject);
 	}
 
 	return nullptr;
@@ -30,18 +18,9 @@ UOverlayWidgetController* UAuraAbilitySystemLibrary::GetOverlayWidgetController(
 UAttributeMenuWidgetController* UAuraAbilitySystemLibrary::GetAttributeMenuWidgetController(
 	const UObject* WorldContextObject)
 {
-	if (APlayerController* PC = UGameplayStatics::GetPlayerController(WorldContextObject, 0); IsValid(PC))
+	if (UAuraWidgetControllerSubsystem* Subsystem = UAuraWidgetControllerSubsystem::Get(WorldContextObject))
 	{
-		if (AAuraHUD* AuraHUD = Cast<AAuraHUD>(PC->GetHUD()))
-		{
-			if (AAuraPlayerState* PS = PC->GetPlayerState<AAuraPlayerState>(); IsValid(PS))
-			{
-				UAbilitySystemComponent* ASC = PS->GetAbilitySystemComponent();
-				UAttributeSet* AS = PS->GetAttributeSet();
-				const FWidgetControllerParams WidgetControllerParams(PC, PS, ASC, AS);
-				return AuraHUD->GetAttributeMenuWidgetController(WidgetControllerParams);
-			}
-		}
+		return Subsystem->GetAttributeMenuWidgetController(WorldContextObject);
 	}
 
 	return nullptr;
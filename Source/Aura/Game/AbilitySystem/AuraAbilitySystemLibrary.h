@@ -39,15 +39,13 @@ public:
 	/**
 	 * @brief Retrieves the Overlay Widget Controller.
 	 *
-	 * This function gets the Overlay Widget Controller for the specified world context.
-	 * It retrieves the player controller from the world context, checks its validity,
-	 * casts the HUD to AAuraHUD, and checks the validity of the player's state.
-	 * If all checks pass, it retrieves the ability system component and attribute set,
-	 * constructs a widget controller parameters struct, and gets the overlay widget
-	 * controller from the HUD.
+	 * This function gets the Overlay Widget Controller of the local player that owns the world context object.
+	 * The controller is served from UAuraWidgetControllerSubsystem, which resolves the player controller, HUD,
+	 * player state, ability system component and attribute set once per local player and caches the result
+	 * until the player's pawn or player state changes.
 	 *
-	 * @param WorldContextObject The context object for the world from which the player controller
-	 *        and other components are retrieved.
+	 * @param WorldContextObject The context object identifying the local player, typically the calling widget.
+	 *        Objects that are not owned by a player fall back to the first local player of their world.
 	 * @return A pointer to the UOverlayWidgetController if successful, otherwise nullptr.
 	 */
 	UFUNCTION(BlueprintPure, Category="AuraAbilitySystemLibrary|WidgetController")
@@ -56,10 +54,10 @@ public:
 	/**
 	 * @brief Retrieves the Attribute Menu Widget Controller for the provided world context object.
 	 *
-	 * This function looks up the player controller, player state, ability system component, and attribute set associated
-	 * with the provided world context object, and uses these to get the Attribute Menu Widget Controller from the player's HUD.
+	 * The controller belongs to the local player that owns the world context object and is served from the
+	 * per-local-player cache of UAuraWidgetControllerSubsystem, so repeated calls cost a single map lookup.
 	 *
-	 * @param WorldContextObject The context object that the world belongs to. This is typically a UObject derived class.
+	 * @param WorldContextObject The context object identifying the local player, typically the calling widget.
 	 * @return UAttributeMenuWidgetController* The Attribute Menu Widget Controller instance if found, otherwise nullptr.
 	 */
 	UFUNCTION(BlueprintPure, Category="AuraAbilitySystemLibrary|WidgetController")
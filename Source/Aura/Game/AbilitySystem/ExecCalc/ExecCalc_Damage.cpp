@@ -0,0 +1,196 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AbilitySystem/ExecCalc/ExecCalc_Damage.h"
+
+#include "AbilitySystemComponent.h"
+#include "Engine/CurveTable.h"
+#include "Game/AbilitySystem/AttributeSet/AuraAttributeSet.h"
+#include "Game/AuraGameplayTags.h"
+#include "Game/Interaction/CombatInterface.h"
+
+namespace ExecCalcDamage
+{
+	/**
+	 * The capture definitions of every attribute the damage calculation reads, built once.
+	 */
+	struct FDamageStatics
+	{
+		DECLARE_ATTRIBUTE_CAPTUREDEF(Armor);
+		DECLARE_ATTRIBUTE_CAPTUREDEF(BlockChance);
+		DECLARE_ATTRIBUTE_CAPTUREDEF(CriticalHitResistance);
+		DECLARE_ATTRIBUTE_CAPTUREDEF(ArmorPenetration);
+		DECLARE_ATTRIBUTE_CAPTUREDEF(CriticalHitChance);
+		DECLARE_ATTRIBUTE_CAPTUREDEF(CriticalHitDamage);
+
+		FDamageStatics()
+		{
+			DEFINE_ATTRIBUTE_CAPTUREDEF(UAuraAttributeSet, Armor, Target, false);
+			DEFINE_ATTRIBUTE_CAPTUREDEF(UAuraAttributeSet, BlockChance, Target, false);
+			DEFINE_ATTRIBUTE_CAPTUREDEF(UAuraAttributeSet, CriticalHitResistance, Target, false);
+			DEFINE_ATTRIBUTE_CAPTUREDEF(UAuraAttributeSet, ArmorPenetration, Source, false);
+			DEFINE_ATTRIBUTE_CAPTUREDEF(UAuraAttributeSet, CriticalHitChance, Source, false);
+			DEFINE_ATTRIBUTE_CAPTUREDEF(UAuraAttributeSet, CriticalHitDamage, Source, false);
+		}
+	};
+
+	const FDamageStatics& DamageStatics()
+	{
+		static const FDamageStatics Statics;
+		return Statics;
+	}
+
+	/**
+	 * Returns the level of the avatar of an ability system component, 1 if it has none.
+	 */
+	int32 GetAvatarLevel(const UAbilitySystemComponent* AbilitySystemComponent)
+	{
+		if (ICombatInterface* CombatInterface = Cast<ICombatInterface>(IsValid(AbilitySystemComponent) ? AbilitySystemComponent->GetAvatarActor() : nullptr))
+		{
+			return CombatInterface->GetPlayerLevel();
+		}
+		return 1;
+	}
+
+	/**
+	 * Returns the captured magnitude of an attribute, never below 0.
+	 */
+	float GetCapturedMagnitude(const FGameplayEffectCustomExecutionParameters& ExecutionParams, const FGameplayEffectAttributeCaptureDefinition& CaptureDef,
+		const FAggregatorEvaluateParameters& EvaluateParameters)
+	{
+		float R_Magnitude = 0.f;
+		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(CaptureDef, EvaluateParameters, R_Magnitude);
+		return FMath::Max(R_Magnitude, 0.f);
+	}
+}
+
+UExecCalc_Damage::UExecCalc_Damage()
+{
+	const ExecCalcDamage::FDamageStatics& L_Statics = ExecCalcDamage::DamageStatics();
+	RelevantAttributesToCapture.Add(L_Statics.ArmorDef);
+	RelevantAttributesToCapture.Add(L_Statics.BlockChanceDef);
+	RelevantAttributesToCapture.Add(L_Statics.CriticalHitResistanceDef);
+	RelevantAttributesToCapture.Add(L_Statics.ArmorPenetrationDef);
+	RelevantAttributesToCapture.Add(L_Statics.CriticalHitChanceDef);
+	RelevantAttributesToCapture.Add(L_Statics.CriticalHitDamageDef);
+
+	CoefficientsByLevel.AddDefaulted();
+}
+
+void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams, FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
+{
+	const ExecCalcDamage::FDamageStatics& L_Statics = ExecCalcDamage::DamageStatics();
+	const FGameplayEffectSpec& L_Spec = ExecutionParams.GetOwningSpec();
+
+	FAggregatorEvaluateParameters L_EvaluateParameters;
+	L_EvaluateParameters.SourceTags = L_Spec.CapturedSourceTags.GetAggregatedTags();
+	L_EvaluateParameters.TargetTags = L_Spec.CapturedTargetTags.GetAggregatedTags();
+
+	const FAuraDamageCoefficients& L_SourceCoefficients = GetCoefficients(ExecCalcDamage::GetAvatarLevel(ExecutionParams.GetSourceAbilitySystemComponent()));
+	const FAuraDamageCoefficients& L_TargetCoefficients = GetCoefficients(ExecCalcDamage::GetAvatarLevel(ExecutionParams.GetTargetAbilitySystemComponent()));
+
+	float L_Damage = L_Spec.GetSetByCallerMagnitude(FAuraGameplayTags::Get().Damage, false, 0.f);
+
+	// Block halves the damage.
+	const float L_TargetBlockChance = ExecCalcDamage::GetCapturedMagnitude(ExecutionParams, L_Statics.BlockChanceDef, L_EvaluateParameters);
+	if (FMath::FRand() * 100.f < L_TargetBlockChance)
+	{
+		L_Damage *= 0.5f;
+	}
+
+	// Armor Penetration ignores a percentage of the target's Armor, the remaining Armor ignores a percentage of the damage.
+	const float L_TargetArmor = ExecCalcDamage::GetCapturedMagnitude(ExecutionParams, L_Statics.ArmorDef, L_EvaluateParameters);
+	const float L_SourceArmorPenetration = ExecCalcDamage::GetCapturedMagnitude(ExecutionParams, L_Statics.ArmorPenetrationDef, L_EvaluateParameters);
+	const float L_EffectiveArmor = L_TargetArmor * FMath::Max(100.f - L_SourceArmorPenetration * L_SourceCoefficients.ArmorPenetration, 0.f) / 100.f;
+	L_Damage *= FMath::Max(100.f - L_EffectiveArmor * L_TargetCoefficients.EffectiveArmor, 0.f) / 100.f;
+
+	// Critical Hit Resistance lowers the chance of a critical hit, which doubles the damage and adds the bonus.
+	const float L_SourceCriticalHitChance = ExecCalcDamage::GetCapturedMagnitude(ExecutionParams, L_Statics.CriticalHitChanceDef, L_EvaluateParameters);
+	const float L_TargetCriticalHitResistance = ExecCalcDamage::GetCapturedMagnitude(ExecutionParams, L_Statics.CriticalHitResistanceDef, L_EvaluateParameters);
+	const float L_EffectiveCriticalHitChance = L_SourceCriticalHitChance - L_TargetCriticalHitResistance * L_TargetCoefficients.CriticalHitResistance;
+	if (FMath::FRand() * 100.f < L_EffectiveCriticalHitChance)
+	{
+		const float L_SourceCriticalHitDamage = ExecCalcDamage::GetCapturedMagnitude(ExecutionParams, L_Statics.CriticalHitDamageDef, L_EvaluateParameters);
+		L_Damage = 2.f * L_Damage + L_SourceCriticalHitDamage;
+	}
+
+	L_Damage = FMath::Max(L_Damage, 0.f);
+	if (L_Damage > 0.f)
+	{
+		// Additive, so UAuraAttributeSet::PostGameplayEffectExecute clamps Health and shows the combat text.
+		OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(UAuraAttributeSet::GetHealthAttribute(), EGameplayModOp::Additive, -L_Damage));
+	}
+}
+
+void UExecCalc_Damage::RebuildCoefficients()
+{
+	CoefficientsByLevel.Reset();
+
+	const FRealCurve* L_ArmorPenetrationCurve = nullptr;
+	const FRealCurve* L_EffectiveArmorCurve = nullptr;
+	const FRealCurve* L_CriticalHitResistanceCurve = nullptr;
+	float L_LastKeyLevel = 0.f;
+
+	if (IsValid(CoefficientTable))
+	{
+		// The table may not be post loaded yet when the class defaults are.
+		CoefficientTable->ConditionalPostLoad();
+
+		static const FString L_ContextString(TEXT("UExecCalc_Damage::RebuildCoefficients"));
+		L_ArmorPenetrationCurve = CoefficientTable->FindCurve(TEXT("ArmorPenetration"), L_ContextString);
+		L_EffectiveArmorCurve = CoefficientTable->FindCurve(TEXT("EffectiveArmor"), L_ContextString);
+		L_CriticalHitResistanceCurve = CoefficientTable->FindCurve(TEXT("CriticalHitResistance"), L_ContextString);
+
+		for (const FRealCurve* Curve : { L_ArmorPenetrationCurve, L_EffectiveArmorCurve, L_CriticalHitResistanceCurve })
+		{
+			if (Curve != nullptr && Curve->GetNumKeys() > 0)
+			{
+				float L_MinLevel = 0.f;
+				float L_MaxLevel = 0.f;
+				Curve->GetTimeRange(L_MinLevel, L_MaxLevel);
+				L_LastKeyLevel = FMath::Max(L_LastKeyLevel, L_MaxLevel);
+			}
+		}
+	}
+
+	const int32 L_NumLevels = FMath::Min(FMath::CeilToInt32(L_LastKeyLevel), MaxBakedLevel) + 1;
+	CoefficientsByLevel.SetNum(L_NumLevels);
+
+	for (int32 Level = 0; Level < L_NumLevels; ++Level)
+	{
+		FAuraDamageCoefficients& Coefficients = CoefficientsByLevel[Level];
+		if (L_ArmorPenetrationCurve != nullptr)
+		{
+			Coefficients.ArmorPenetration = L_ArmorPenetrationCurve->Eval(static_cast<float>(Level));
+		}
+		if (L_EffectiveArmorCurve != nullptr)
+		{
+			Coefficients.EffectiveArmor = L_EffectiveArmorCurve->Eval(static_cast<float>(Level));
+		}
+		if (L_CriticalHitResistanceCurve != nullptr)
+		{
+			Coefficients.CriticalHitResistance = L_CriticalHitResistanceCurve->Eval(static_cast<float>(Level));
+		}
+	}
+}
+
+void UExecCalc_Damage::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildCoefficients();
+}
+
+#if WITH_EDITOR
+void UExecCalc_Damage::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildCoefficients();
+}
+#endif
+
+const FAuraDamageCoefficients& UExecCalc_Damage::GetCoefficients(int32 Level) const
+{
+	return CoefficientsByLevel[FMath::Clamp(Level, 0, CoefficientsByLevel.Num() - 1)];
+}
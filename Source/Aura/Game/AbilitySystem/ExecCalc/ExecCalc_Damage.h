@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectExecutionCalculation.h"
+#include "ExecCalc_Damage.generated.h"
+
+class UCurveTable;
+
+/**
+ * @struct FAuraDamageCoefficients
+ * @brief The level based coefficients of the damage calculation for a single level.
+ */
+struct FAuraDamageCoefficients
+{
+	/** Scales the source's Armor Penetration before it is subtracted from the target's Armor. */
+	float ArmorPenetration = 0.25f;
+
+	/** Scales the effective Armor of the target before it reduces the damage. */
+	float EffectiveArmor = 0.333f;
+
+	/** Scales the target's Critical Hit Resistance before it is subtracted from the source's Critical Hit Chance. */
+	float CriticalHitResistance = 0.25f;
+};
+
+/**
+ * @class UExecCalc_Damage
+ * @brief Computes the damage a gameplay effect deals to Health from the secondary attributes of source and target.
+ *
+ * The base damage is the set by caller magnitude of FAuraGameplayTags::Damage. In order, the calculation:
+ * - halves the damage when the target blocks, with the target's Block Chance;
+ * - reduces the damage by the target's Armor, of which the source's Armor Penetration ignores a part;
+ * - doubles the damage and adds the source's Critical Hit Damage on a critical hit, with the source's Critical Hit
+ *   Chance reduced by the target's Critical Hit Resistance.
+ *
+ * Armor Penetration is scaled by a coefficient for the source level, Effective Armor and Critical Hit Resistance by
+ * coefficients for the target level. The coefficients come from the ArmorPenetration, EffectiveArmor and
+ * CriticalHitResistance rows of CoefficientTable, which are evaluated once per integer level into a flat array when the
+ * class defaults load. Each execution is an array index per level, with no curve evaluation and no row lookup.
+ * Without a table, the defaults of FAuraDamageCoefficients apply at every level.
+ *
+ * Assign the table on a Blueprint subclass and use that subclass as the execution of the damage effects.
+ */
+UCLASS()
+class AURA_API UExecCalc_Damage : public UGameplayEffectExecutionCalculation
+{
+	GENERATED_BODY()
+
+public:
+	UExecCalc_Damage();
+
+	virtual void Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams, FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const override;
+
+	/**
+	 * Bakes the rows of CoefficientTable into CoefficientsByLevel.
+	 *
+	 * Called automatically after loading and after editing the class defaults. Levels past the last key of the table
+	 * use the coefficients of the last baked level.
+	 */
+	void RebuildCoefficients();
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+protected:
+	/**
+	 * Curve table with the ArmorPenetration, EffectiveArmor and CriticalHitResistance rows, keyed by level.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Damage")
+	TObjectPtr<UCurveTable> CoefficientTable = nullptr;
+
+	/**
+	 * Highest level baked from CoefficientTable, regardless of how far its keys go.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Damage", meta = (ClampMin = 1))
+	int32 MaxBakedLevel = 100;
+
+private:
+	/**
+	 * Returns the coefficients of a level, clamped to the baked range.
+	 */
+	const FAuraDamageCoefficients& GetCoefficients(int32 Level) const;
+
+	/**
+	 * The coefficients of every level from 0, baked from CoefficientTable.
+	 */
+	TArray<FAuraDamageCoefficients> CoefficientsByLevel;
+};
@@ -4,7 +4,6 @@
 #include "MMC_MaxHealth.h"
 
 #include "Aura/Game/AbilitySystem/AttributeSet/AuraAttributeSet.h"
-#include "Aura/Game/Interaction/CombatInterface.h"
 
 UMMC_MaxHealth::UMMC_MaxHealth()
 {
@@ -30,8 +29,8 @@ float UMMC_MaxHealth::CalculateBaseMagnitude_Implementation(const FGameplayEffec
 	GetCapturedAttributeMagnitude(VigorDef, Spec, EvaluateParameters, Vigor);
 	Vigor = FMath::Max<float>(Vigor, 0.f);
 
-	ICombatInterface* CombatInterface = Cast<ICombatInterface>(Spec.GetContext().GetSourceObject());
-	const int32 PlayerLevel = CombatInterface->GetPlayerLevel();
+	// The effect is applied at the level of the character and moved along by SetActiveGameplayEffectLevel on level up.
+	const int32 PlayerLevel = FMath::RoundToInt32(Spec.GetLevel());
 
 	const float R_BaseValue = 80.f + 2.5f * Vigor + 10.f * PlayerLevel;
 
@@ -4,7 +4,6 @@
 #include "MMC_MaxMana.h"
 
 #include "Aura/Game/AbilitySystem/AttributeSet/AuraAttributeSet.h"
-#include "Aura/Game/Interaction/CombatInterface.h"
 
 
 UMMC_MaxMana::UMMC_MaxMana()
@@ -31,8 +30,8 @@ float UMMC_MaxMana::CalculateBaseMagnitude_Implementation(const FGameplayEffectS
 	GetCapturedAttributeMagnitude(IntelligenceDef, Spec, EvaluateParameters, Intelligence);
 	Intelligence = FMath::Max<float>(Intelligence, 0.f);
 
-	ICombatInterface* CombatInterface = Cast<ICombatInterface>(Spec.GetContext().GetSourceObject());
-	const int32 PlayerLevel = CombatInterface->GetPlayerLevel();
+	// The effect is applied at the level of the character and moved along by SetActiveGameplayEffectLevel on level up.
+	const int32 PlayerLevel = FMath::RoundToInt32(Spec.GetLevel());
 
 	const float R_BaseValue = 50.f + 2.5f * Intelligence + 15.f * PlayerLevel;
 
@@ -4,6 +4,11 @@
 #include "AuraAssetManager.h"
 
 #include "AuraGameplayTags.h"
+#include "Misc/CoreDelegates.h"
+#include "Game/Profiling/AuraStartupProfiler.h"
+
+const FPrimaryAssetType UAuraAssetManager::AbilityAssetType = TEXT("AuraAbility");
+const FPrimaryAssetType UAuraAssetManager::ProjectileAssetType = TEXT("AuraProjectile");
 
 UAuraAssetManager& UAuraAssetManager::Get()
 {
@@ -14,9 +19,48 @@ UAuraAssetManager& UAuraAssetManager::Get()
 	return *AuraAssetManager;
 }
 
+TSharedPtr<FStreamableHandle> UAuraAssetManager::LoadUIAssetsAsync(const TArray<FSoftObjectPath>& AssetsToLoad, FStreamableDelegate OnLoaded)
+{
+	return RequestFilteredAsyncLoad(AssetsToLoad, MoveTemp(OnLoaded), FStreamableManager::AsyncLoadHighPriority, TEXT("AuraUI"));
+}
+
+TSharedPtr<FStreamableHandle> UAuraAssetManager::LoadGameplayAssetsAsync(const TArray<FSoftObjectPath>& AssetsToLoad, FStreamableDelegate OnLoaded)
+{
+	return RequestFilteredAsyncLoad(AssetsToLoad, MoveTemp(OnLoaded), FStreamableManager::DefaultAsyncLoadPriority, TEXT("AuraGameplay"));
+}
+
 void UAuraAssetManager::StartInitialLoading()
 {
+	FAuraStartupProfiler::MarkPhase(TEXT("StartInitialLoading"));
+
 	Super::StartInitialLoading();
 
 	FAuraGameplayTags::InitializeNativeGameplayTags();
+
+	FAuraStartupProfiler::MarkPhase(TEXT("InitialLoadingDone"));
+	FCoreDelegates::OnPostEngineInit.AddLambda([]()
+	{
+		FAuraStartupProfiler::MarkPhase(TEXT("PostEngineInit"));
+	});
+}
+
+TSharedPtr<FStreamableHandle> UAuraAssetManager::RequestFilteredAsyncLoad(const TArray<FSoftObjectPath>& AssetsToLoad, FStreamableDelegate OnLoaded, TAsyncLoadPriority Priority, const FString& DebugName)
+{
+	TArray<FSoftObjectPath> L_ValidAssets;
+	L_ValidAssets.Reserve(AssetsToLoad.Num());
+	for (const FSoftObjectPath& AssetPath : AssetsToLoad)
+	{
+		if (!AssetPath.IsNull())
+		{
+			L_ValidAssets.AddUnique(AssetPath);
+		}
+	}
+
+	if (L_ValidAssets.Num() == 0)
+	{
+		OnLoaded.ExecuteIfBound();
+		return nullptr;
+	}
+
+	return GetStreamableManager().RequestAsyncLoad(L_ValidAssets, MoveTemp(OnLoaded), Priority, false, false, DebugName);
 }
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "AuraAssetManager.generated.h"
 
 /**
@@ -39,7 +40,41 @@ public:
 	 *
 	 * @return A reference to the singleton instance of UAuraAssetManager.
 	 */
-	UAuraAssetManager& Get();
+	static UAuraAssetManager& Get();
+
+	/**
+	 * @brief Streams in the given UI assets without blocking the game thread.
+	 *
+	 * Used for the HUD's widget and controller classes and the UI data tables, which are soft references so that
+	 * they are not loaded together with the map. Loads run at high priority since the player is waiting for them.
+	 *
+	 * @param AssetsToLoad The soft paths of the assets to load. Null paths are ignored.
+	 * @param OnLoaded Called on the game thread once all assets are loaded, or right away if they already are.
+	 * @return The streamable handle. Keep it alive for as long as the assets must stay resident.
+	 */
+	TSharedPtr<FStreamableHandle> LoadUIAssetsAsync(const TArray<FSoftObjectPath>& AssetsToLoad, FStreamableDelegate OnLoaded);
+
+	/**
+	 * @brief Streams in the given gameplay assets without blocking the game thread.
+	 *
+	 * Used by characters to preload their startup abilities, default attribute effects and whatever the abilities
+	 * spawn, so that nothing has to be loaded synchronously the first time an ability is activated.
+	 *
+	 * @param AssetsToLoad The soft paths of the assets to load. Null paths are ignored.
+	 * @param OnLoaded Called on the game thread once all assets are loaded, or right away if they already are.
+	 * @return The streamable handle. Keep it alive for as long as the assets must stay resident.
+	 */
+	TSharedPtr<FStreamableHandle> LoadGameplayAssetsAsync(const TArray<FSoftObjectPath>& AssetsToLoad, FStreamableDelegate OnLoaded);
+
+	/**
+	 * Primary asset type of blueprint gameplay abilities derived from UAuraGameplayAbility.
+	 */
+	static const FPrimaryAssetType AbilityAssetType;
+
+	/**
+	 * Primary asset type of blueprint projectiles derived from AAuraProjectile.
+	 */
+	static const FPrimaryAssetType ProjectileAssetType;
 
 protected:
 	/**
@@ -53,4 +88,10 @@ protected:
 	 * @note Ensure that all required preconditions are met before calling this method.
 	 */
 	virtual void StartInitialLoading() override;
+
+private:
+	/**
+	 * Drops null and duplicate paths and requests an async load of the rest at the given priority.
+	 */
+	TSharedPtr<FStreamableHandle> RequestFilteredAsyncLoad(const TArray<FSoftObjectPath>& AssetsToLoad, FStreamableDelegate OnLoaded, TAsyncLoadPriority Priority, const FString& DebugName);
 };
@@ -9,115 +9,126 @@ FAuraGameplayTags FAuraGameplayTags::GameplayTags;
 
 void FAuraGameplayTags::InitializeNativeGameplayTags()
 {
-	/*
-	 * Primary Attributes
-	 */
-	GameplayTags.Attributes_Primary_Strength = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Primary.Strength"),
-		FString("Increases physical damage")
-		);
-
-	GameplayTags.Attributes_Primary_Intelligence = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Primary.Intelligence"),
-		FString("Increases magical damage")
-		);
-
-	GameplayTags.Attributes_Primary_Resilience = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Primary.Resilience"),
-		FString("Increases Armor and Armor Penetration")
-		);
-
-	GameplayTags.Attributes_Primary_Vigor = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Primary.Vigor"),
-		FString("Increases Health")
-		);
-
-
-	/*
-	 * Secondary Attributes
-	 */
-
-	GameplayTags.Attributes_Secondary_Armor = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Secondary.Armor"),
-		FString("Reduces damage taken, improves Block Chance")
-		);
-
-	GameplayTags.Attributes_Secondary_ArmorPenetration = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Secondary.ArmorPenetration"),
-		FString("Ignores Percentage of enemy Armor, increases Critical Hit Chance")
-		);
-
-	GameplayTags.Attributes_Secondary_BlockChance = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Secondary.BlockChance"),
-		FString("Chance to cut incoming damage in half")
-		);
-
-	GameplayTags.Attributes_Secondary_CriticalHitChance = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Secondary.CriticalHitChance"),
-		FString("Chance to double damage plus critical hit bonus")
-		);
-
-	GameplayTags.Attributes_Secondary_CriticalHitDamage = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Secondary.CriticalHitDamage"),
-		FString("Bonus damage added when a critical hit is scored")
-		);
-
-	GameplayTags.Attributes_Secondary_CriticalHitResistance = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Secondary.CriticalHitResistance"),
-		FString("Reduces Critical Hit Chance of attacking enemies")
-		);
-
-	GameplayTags.Attributes_Secondary_HealthRegeneration = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Secondary.HealthRegeneration"),
-		FString("Amount of Health regenerated every 1 second")
-		);
-
-	GameplayTags.Attributes_Secondary_ManaRegeneration = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Secondary.ManaRegeneration"),
-		FString("Amount of Mana regenerated every 1 second")
-		);
-
-	GameplayTags.Attributes_Secondary_MaxHealth = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Secondary.MaxHealth"),
-		FString("Maximum amount of Health obtainable")
-		);
-
-	GameplayTags.Attributes_Secondary_MaxMana = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("Attributes.Secondary.MaxMana"),
-		FString("Maximum amount of Mana obtainable")
-		);
-
-	/*
-	 * Input Tags
-	 */
-
-	GameplayTags.InputTag_LMB = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("InputTag.LMB"),
-		FString("Input Tag for Left Mouse Button")
-		);
-
-	GameplayTags.InputTag_RMB = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("InputTag.RMB"),
-		FString("Input Tag for Right Mouse Button")
-		);
-
-	GameplayTags.InputTag_1 = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("InputTag.1"),
-		FString("Input Tag for 1 key")
-		);
-
-	GameplayTags.InputTag_2 = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("InputTag.2"),
-		FString("Input Tag for 2 key")
-		);
-
-	GameplayTags.InputTag_3 = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("InputTag.3"),
-		FString("Input Tag for 3 key")
-		);
-
-	GameplayTags.InputTag_4 = UGameplayTagsManager::Get().AddNativeGameplayTag(
-		FName("InputTag.4"),
-		FString("Input Tag for 4 key")
-		);
+	UGameplayTagsManager& TagsManager = UGameplayTagsManager::Get();
+
+#define AURA_ADD_NATIVE_GAMEPLAY_TAG(Member, TagName, Description) \
+	GameplayTags.Member = TagsManager.AddNativeGameplayTag(FName(TagName), FString(Description)); \
+	GameplayTags.TagsByIndex[static_cast<int32>(EAuraGameplayTag::Member)] = GameplayTags.Member;
+	AURA_NATIVE_GAMEPLAY_TAGS(AURA_ADD_NATIVE_GAMEPLAY_TAG)
+#undef AURA_ADD_NATIVE_GAMEPLAY_TAG
+
+	ValidateAndIndexNativeGameplayTags();
+}
+
+EAuraGameplayTag FAuraGameplayTags::FindTagIndex(const FGameplayTag& Tag)
+{
+	if (const EAuraGameplayTag* L_Index = GameplayTags.IndicesByTag.Find(Tag))
+	{
+		return *L_Index;
+	}
+
+	return EAuraGameplayTag::Count;
+}
+
+bool FAuraGameplayTags::MatchesTag(EAuraGameplayTag Tag, EAuraGameplayTag Parent)
+{
+	return GetSelfAndDescendants(Parent).HasTagExact(Tag);
+}
+
+bool FAuraGameplayTags::MatchesTag(const FGameplayTag& Tag, EAuraGameplayTag Parent)
+{
+	if (const EAuraGameplayTag L_Index = FindTagIndex(Tag); L_Index != EAuraGameplayTag::Count)
+	{
+		return MatchesTag(L_Index, Parent);
+	}
+
+	return Tag.MatchesTag(GetTag(Parent));
+}
+
+FAuraGameplayTagBitSet FAuraGameplayTags::GetNativeAncestors(const FGameplayTag& Tag)
+{
+	if (const FAuraGameplayTagBitSet* L_Ancestors = GameplayTags.NativeAncestorsByTag.Find(Tag))
+	{
+		return *L_Ancestors;
+	}
+
+	if (!Tag.IsValid())
+	{
+		return FAuraGameplayTagBitSet();
+	}
+
+	return GameplayTags.NativeAncestorsByTag.Add(Tag, CompileNativeAncestors(Tag));
+}
+
+FAuraGameplayTagBitSet FAuraGameplayTags::CompileNativeAncestors(const FGameplayTag& Tag)
+{
+	FAuraGameplayTagBitSet R_Ancestors;
+	for (const FGameplayTag& SelfOrParent : Tag.GetGameplayTagParents())
+	{
+		R_Ancestors.AddTag(SelfOrParent);
+	}
+	return R_Ancestors;
+}
+
+void FAuraGameplayTags::ValidateAndIndexNativeGameplayTags()
+{
+	static_assert(FAuraGameplayTagBitSet::NumTags <= 255, "EAuraGameplayTag is stored as uint8");
+
+	GameplayTags.IndicesByTag.Reset();
+	GameplayTags.IndicesByTag.Reserve(FAuraGameplayTagBitSet::NumTags);
+
+	for (int32 Index = 0; Index < FAuraGameplayTagBitSet::NumTags; ++Index)
+	{
+		const FGameplayTag& Tag = GameplayTags.TagsByIndex[Index];
+		checkf(Tag.IsValid(), TEXT("Native gameplay tag at index %d was not registered"), Index);
+		checkf(!GameplayTags.IndicesByTag.Contains(Tag), TEXT("Native gameplay tag [%s] appears twice in AURA_NATIVE_GAMEPLAY_TAGS"), *Tag.ToString());
+
+		GameplayTags.IndicesByTag.Add(Tag, static_cast<EAuraGameplayTag>(Index));
+	}
+
+	for (int32 ParentIndex = 0; ParentIndex < FAuraGameplayTagBitSet::NumTags; ++ParentIndex)
+	{
+		FAuraGameplayTagBitSet& Mask = GameplayTags.SelfAndDescendantMasks[ParentIndex];
+		Mask.Reset();
+
+		const FGameplayTag& Parent = GameplayTags.TagsByIndex[ParentIndex];
+		for (int32 Index = 0; Index < FAuraGameplayTagBitSet::NumTags; ++Index)
+		{
+			if (GameplayTags.TagsByIndex[Index].MatchesTag(Parent))
+			{
+				Mask.AddTag(static_cast<EAuraGameplayTag>(Index));
+			}
+		}
+	}
+
+	// Compile the routing table for every tag known at startup, so the first effect of a kind never pays for it.
+	FGameplayTagContainer L_AllTags;
+	UGameplayTagsManager::Get().RequestAllGameplayTags(L_AllTags, false);
+
+	GameplayTags.NativeAncestorsByTag.Reset();
+	GameplayTags.NativeAncestorsByTag.Reserve(L_AllTags.Num());
+	for (const FGameplayTag& Tag : L_AllTags)
+	{
+		GameplayTags.NativeAncestorsByTag.Add(Tag, CompileNativeAncestors(Tag));
+	}
+}
+
+FAuraGameplayTagBitSet::FAuraGameplayTagBitSet(const FGameplayTagContainer& Container)
+{
+	for (const FGameplayTag& Tag : Container)
+	{
+		AddTag(Tag);
+	}
+}
+
+bool FAuraGameplayTagBitSet::AddTag(const FGameplayTag& Tag)
+{
+	const EAuraGameplayTag L_Index = FAuraGameplayTags::FindTagIndex(Tag);
+	if (L_Index == EAuraGameplayTag::Count)
+	{
+		return false;
+	}
+
+	AddTag(L_Index);
+	return true;
 }
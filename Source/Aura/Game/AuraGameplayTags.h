@@ -5,6 +5,167 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 
+/**
+ * @brief The table of all native gameplay tags of the Aura project.
+ *
+ * Each row is X(Member, "Tag.Name", "Description"). The table generates the FAuraGameplayTags members, the dense
+ * EAuraGameplayTag index and the registration in FAuraGameplayTags::InitializeNativeGameplayTags, so adding a tag
+ * is a single new row. Parents are listed before their children and get rows of their own, so that parent matching
+ * between native tags can be answered from precomputed bitsets.
+ */
+#define AURA_NATIVE_GAMEPLAY_TAGS(X) \
+	/* Attributes */ \
+	X(Attributes, "Attributes", "Parent of all attribute tags") \
+	X(Attributes_Primary, "Attributes.Primary", "Parent of the primary attribute tags") \
+	X(Attributes_Primary_Strength, "Attributes.Primary.Strength", "Increases physical damage") \
+	X(Attributes_Primary_Intelligence, "Attributes.Primary.Intelligence", "Increases magical damage") \
+	X(Attributes_Primary_Resilience, "Attributes.Primary.Resilience", "Increases Armor and Armor Penetration") \
+	X(Attributes_Primary_Vigor, "Attributes.Primary.Vigor", "Increases Health") \
+	X(Attributes_Secondary, "Attributes.Secondary", "Parent of the secondary attribute tags") \
+	X(Attributes_Secondary_Armor, "Attributes.Secondary.Armor", "Reduces damage taken, improves Block Chance") \
+	X(Attributes_Secondary_ArmorPenetration, "Attributes.Secondary.ArmorPenetration", "Ignores Percentage of enemy Armor, increases Critical Hit Chance") \
+	X(Attributes_Secondary_BlockChance, "Attributes.Secondary.BlockChance", "Chance to cut incoming damage in half") \
+	X(Attributes_Secondary_CriticalHitChance, "Attributes.Secondary.CriticalHitChance", "Chance to double damage plus critical hit bonus") \
+	X(Attributes_Secondary_CriticalHitDamage, "Attributes.Secondary.CriticalHitDamage", "Bonus damage added when a critical hit is scored") \
+	X(Attributes_Secondary_CriticalHitResistance, "Attributes.Secondary.CriticalHitResistance", "Reduces Critical Hit Chance of attacking enemies") \
+	X(Attributes_Secondary_HealthRegeneration, "Attributes.Secondary.HealthRegeneration", "Amount of Health regenerated every 1 second") \
+	X(Attributes_Secondary_ManaRegeneration, "Attributes.Secondary.ManaRegeneration", "Amount of Mana regenerated every 1 second") \
+	X(Attributes_Secondary_MaxHealth, "Attributes.Secondary.MaxHealth", "Maximum amount of Health obtainable") \
+	X(Attributes_Secondary_MaxMana, "Attributes.Secondary.MaxMana", "Maximum amount of Mana obtainable") \
+	/* Damage */ \
+	X(Damage, "Damage", "Set by caller magnitude of the damage a gameplay effect deals") \
+	/* Input */ \
+	X(InputTag, "InputTag", "Parent of all input tags") \
+	X(InputTag_LMB, "InputTag.LMB", "Input Tag for Left Mouse Button") \
+	X(InputTag_RMB, "InputTag.RMB", "Input Tag for Right Mouse Button") \
+	X(InputTag_1, "InputTag.1", "Input Tag for 1 key") \
+	X(InputTag_2, "InputTag.2", "Input Tag for 2 key") \
+	X(InputTag_3, "InputTag.3", "Input Tag for 3 key") \
+	X(InputTag_4, "InputTag.4", "Input Tag for 4 key") \
+	/* Messages */ \
+	X(Message, "Message", "Parent of all UI message tags")
+
+/**
+ * @brief Dense Aura-local index of every native gameplay tag, in table order.
+ */
+enum class EAuraGameplayTag : uint8
+{
+#define AURA_DECLARE_GAMEPLAY_TAG_INDEX(Member, TagName, Description) Member,
+	AURA_NATIVE_GAMEPLAY_TAGS(AURA_DECLARE_GAMEPLAY_TAG_INDEX)
+#undef AURA_DECLARE_GAMEPLAY_TAG_INDEX
+	Count
+};
+
+/**
+ * @brief A fixed-size set of native Aura gameplay tags, one bit per EAuraGameplayTag.
+ *
+ * Meant for hot paths such as input tag dispatch and message filtering. Exact queries are a single bit test, parent
+ * queries a few word-wide ANDs against the precomputed descendant masks of FAuraGameplayTags. Tags outside the native
+ * table cannot be stored.
+ */
+struct AURA_API FAuraGameplayTagBitSet
+{
+	static constexpr int32 NumTags = static_cast<int32>(EAuraGameplayTag::Count);
+	static constexpr int32 NumWords = (NumTags + 63) / 64;
+
+	FAuraGameplayTagBitSet() = default;
+
+	/**
+	 * Builds the set from the native tags of a container. Non-native tags are skipped.
+	 */
+	explicit FAuraGameplayTagBitSet(const FGameplayTagContainer& Container);
+
+	void AddTag(EAuraGameplayTag Tag)
+	{
+		const int32 L_Index = static_cast<int32>(Tag);
+		Words[L_Index / 64] |= uint64(1) << (L_Index % 64);
+	}
+
+	void RemoveTag(EAuraGameplayTag Tag)
+	{
+		const int32 L_Index = static_cast<int32>(Tag);
+		Words[L_Index / 64] &= ~(uint64(1) << (L_Index % 64));
+	}
+
+	/**
+	 * Adds a gameplay tag if it is part of the native table.
+	 *
+	 * @return True if the tag was native and added.
+	 */
+	bool AddTag(const FGameplayTag& Tag);
+
+	bool HasTagExact(EAuraGameplayTag Tag) const
+	{
+		const int32 L_Index = static_cast<int32>(Tag);
+		return (Words[L_Index / 64] & (uint64(1) << (L_Index % 64))) != 0;
+	}
+
+	/**
+	 * @return True if the set contains Parent or any native tag below it.
+	 */
+	bool HasTag(EAuraGameplayTag Parent) const;
+
+	bool HasAny(const FAuraGameplayTagBitSet& Other) const
+	{
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			if ((Words[WordIndex] & Other.Words[WordIndex]) != 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	FAuraGameplayTagBitSet operator&(const FAuraGameplayTagBitSet& Other) const
+	{
+		FAuraGameplayTagBitSet R_Intersection;
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			R_Intersection.Words[WordIndex] = Words[WordIndex] & Other.Words[WordIndex];
+		}
+		return R_Intersection;
+	}
+
+	bool IsEmpty() const
+	{
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			if (Words[WordIndex] != 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void Reset()
+	{
+		FMemory::Memzero(Words);
+	}
+
+	/**
+	 * Calls Func(EAuraGameplayTag) for every tag in the set, in index order.
+	 */
+	template<typename FuncType>
+	void ForEachTag(FuncType&& Func) const
+	{
+		for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+		{
+			uint64 L_Word = Words[WordIndex];
+			while (L_Word != 0)
+			{
+				const int32 L_Bit = static_cast<int32>(FMath::CountTrailingZeros64(L_Word));
+				Func(static_cast<EAuraGameplayTag>(WordIndex * 64 + L_Bit));
+				L_Word &= L_Word - 1;
+			}
+		}
+	}
+
+private:
+	uint64 Words[NumWords] = {};
+};
+
 /**
  * @brief The FAuraGameplayTags class serves as a centralized structure to manage and retrieve gameplay tags
  * used throughout the application.
@@ -57,203 +218,129 @@ public:
 	 * - Max Health: Maximum amount of Health obtainable.
 	 * - Max Mana: Maximum amount of Mana obtainable.
 	 *
+	 * The damage tag is the set by caller key of the base damage read by UExecCalc_Damage.
+	 *
 	 * The input tags include:
 	 * - Input Tag for the Left Mouse Button (LMB).
 	 * - Input Tag for the Right Mouse Button (RMB).
 	 * - Input Tags for the keys 1, 2, 3, and 4.
+	 *
+	 * All tags come from AURA_NATIVE_GAMEPLAY_TAGS. Once registered, every tag is checked for validity and
+	 * uniqueness, and the index lookups and descendant masks used by FAuraGameplayTagBitSet are built.
 	 */
 	static void InitializeNativeGameplayTags();
 
 	/**
-	 * Gameplay tag representing the Strength attribute in the primary attributes category.
-	 * Used to identify and modify characteristics related to the Strength stat in gameplay mechanics.
-	 */
-	FGameplayTag Attributes_Primary_Strength;
-	/**
-	 * Represents the gameplay tag associated with the primary attribute Intelligence.
-	 * This tag is used to identify and interact with the Intelligence attribute in
-	 * gameplay systems, ensuring consistent handling and referencing within the game framework.
+	 * One FGameplayTag member per row of AURA_NATIVE_GAMEPLAY_TAGS, named after the row, e.g. Attributes_Primary_Strength
+	 * or InputTag_LMB. See the table for the tag names and their descriptions.
 	 */
-	FGameplayTag Attributes_Primary_Intelligence;
+#define AURA_DECLARE_GAMEPLAY_TAG_MEMBER(Member, TagName, Description) FGameplayTag Member;
+	AURA_NATIVE_GAMEPLAY_TAGS(AURA_DECLARE_GAMEPLAY_TAG_MEMBER)
+#undef AURA_DECLARE_GAMEPLAY_TAG_MEMBER
+
 	/**
-	 * @brief Represents the primary attribute of resilience in a system.
-	 *
-	 * This variable is used to define or manipulate the resilience attribute
-	 * within the primary set of attributes for a character, entity, or object.
-	 * Resilience often signifies the ability to withstand hardships, recover
-	 * from damage, or maintain stability under stress in a given environment.
+	 * @brief Returns the native tag with the given index.
 	 *
-	 * Usage depends on the specific system or mechanics implemented, typically
-	 * related to stamina, defense, recovery, or durability characteristics.
-	 */
-	FGameplayTag Attributes_Primary_Resilience;
-	/**
-	 * Represents the primary vigor attribute gameplay tag used for identifying or categorizing
-	 * gameplay elements related to the vigor attribute within the gameplay framework.
+	 * @param Tag The Aura-local index of the tag.
+	 * @return The registered gameplay tag.
 	 */
-	FGameplayTag Attributes_Primary_Vigor;
-
+	static const FGameplayTag& GetTag(EAuraGameplayTag Tag) { return GameplayTags.TagsByIndex[static_cast<int32>(Tag)]; }
 
 	/**
-	 * A gameplay tag representing the secondary armor attribute in the game.
-	 * This tag can be used to identify and manage gameplay elements associated with secondary armor,
-	 * such as modifiers, effects, or interactions affecting the secondary armor attribute.
-	 */
-	FGameplayTag Attributes_Secondary_Armor;
-	/**
-	 * @brief Represents the secondary attribute for armor penetration in a game or system.
-	 *
-	 * This variable is used to define the degree to which an entity is capable of
-	 * bypassing or reducing an opponent's armor or defense mechanisms during calculations
-	 * related to damage or attack resolution. Higher values may indicate greater
-	 * effectiveness in penetrating armor.
+	 * @brief Returns the Aura-local index of a gameplay tag.
 	 *
-	 * @note The functionality or impact of this attribute may depend on the specific
-	 *       implementation of armor or damage mechanics within the system.
-	 */
-	FGameplayTag Attributes_Secondary_ArmorPenetration;
-	/**
-	 * Represents a gameplay tag associated with the block chance attribute in the secondary attributes category.
-	 * This tag is typically used to define or reference block chance-related gameplay mechanics or properties.
+	 * @param Tag Any gameplay tag.
+	 * @return The index of the tag, or EAuraGameplayTag::Count if the tag is not part of the native table,
+	 *         e.g. a tag only defined in the project's tag ini files.
 	 */
-	FGameplayTag Attributes_Secondary_BlockChance;
+	static EAuraGameplayTag FindTagIndex(const FGameplayTag& Tag);
+
 	/**
-	 * @brief Represents the critical hit chance as a secondary attribute.
-	 *
-	 * This variable stores the percentage chance of performing a critical hit in combat
-	 * or gameplay interactions. A critical hit typically deals extra damage or has
-	 * an enhanced effect compared to a standard action.
+	 * @brief Returns the bitset of a native tag and all native tags below it in the hierarchy.
 	 *
-	 * It is considered a secondary attribute, meaning it is derived or influenced
-	 * by other primary attributes or factors such as equipment, skills, or buffs.
+	 * Precomputed at startup, so parent matching between native tags is a single bit test.
 	 *
-	 * The value is generally expected to be within a defined range, often represented
-	 * as a percentage (e.g., 0 to 100), though this may depend on the specific implementation.
+	 * @param Tag The Aura-local index of the parent tag.
 	 */
-	FGameplayTag Attributes_Secondary_CriticalHitChance;
+	static const FAuraGameplayTagBitSet& GetSelfAndDescendants(EAuraGameplayTag Tag) { return GameplayTags.SelfAndDescendantMasks[static_cast<int32>(Tag)]; }
+
 	/**
-	 * @brief Represents the attribute value associated with the critical hit damage modifier
-	 * in a secondary attribute category.
-	 *
-	 * This variable typically defines the multiplier or percentage bonus that is applied
-	 * to damage dealt during a critical hit event, enhancing the total damage output.
-	 * It is commonly used in systems such as combat mechanics, character statistics, or
-	 * weapon attributes in games or simulations.
+	 * @brief Native counterpart of FGameplayTag::MatchesTag for two native tags.
 	 *
-	 * The value for Attributes_Secondary_CriticalHitDamage could vary based on the context,
-	 * such as character level, equipment bonuses, or other gameplay modifiers.
-	 */
-	FGameplayTag Attributes_Secondary_CriticalHitDamage;
-	/**
-	 * Represents a gameplay tag associated with the secondary attribute "Critical Hit Resistance."
-	 * This attribute typically defines a character's ability to resist or reduce the effects of critical hits.
-	 * It may influence gameplay mechanics such as damage reduction or the probability of receiving critical hits.
+	 * @param Tag The tag to test.
+	 * @param Parent The tag that must be equal to or a parent of Tag.
+	 * @return True if Tag is Parent or one of its descendants.
 	 */
-	FGameplayTag Attributes_Secondary_CriticalHitResistance;
+	static bool MatchesTag(EAuraGameplayTag Tag, EAuraGameplayTag Parent);
+
 	/**
-	 * @brief Represents the secondary attribute for health regeneration in a character or entity.
+	 * @brief Tests any gameplay tag against a native parent tag.
 	 *
-	 * This variable is used to define or calculate the rate at which an entity regenerates health over time.
-	 * It is typically utilized in gameplay mechanics where health recovery is influenced by specific secondary
-	 * attributes or custom behavior.
+	 * Native tags are answered from the precomputed masks. Tags outside the native table, such as the message tags
+	 * defined in ini files, fall back to FGameplayTag::MatchesTag.
 	 *
-	 * @note The exact implementation and scaling factors for health regeneration may vary depending on the game
-	 * or application design.
+	 * @param Tag The tag to test.
+	 * @param Parent The tag that must be equal to or a parent of Tag.
+	 * @return True if Tag is Parent or one of its descendants.
 	 */
-	FGameplayTag Attributes_Secondary_HealthRegeneration;
+	static bool MatchesTag(const FGameplayTag& Tag, EAuraGameplayTag Parent);
+
 	/**
-	 * @brief Represents the rate at which mana regenerates over time.
+	 * @brief Returns the native tags that any gameplay tag matches, i.e. itself if native and all its native parents.
 	 *
-	 * This variable is used to track and modify the secondary attribute
-	 * associated with mana regeneration. It determines the regeneration of
-	 * mana points for a character or entity within a specified period.
+	 * Precompiled at startup for every registered tag, including the ones only defined in ini files, so routing a tag
+	 * to handlers registered on native parents is a single lookup. Tags registered later are compiled on first use.
 	 *
-	 * Commonly used in game mechanics or systems where mana is required for
-	 * abilities, spells, or other resource-driven actions.
-	 *
-	 * Adjustments to this variable can influence the recovery rate of mana,
-	 * impacting gameplay balance and resource management.
+	 * @param Tag Any gameplay tag.
+	 * @return The set of native tags Tag matches. Empty for tags with no native parent.
 	 */
-	FGameplayTag Attributes_Secondary_ManaRegeneration;
+	static FAuraGameplayTagBitSet GetNativeAncestors(const FGameplayTag& Tag);
+
+private:
 	/**
-	 * Represents a gameplay tag associated with the maximum mana attribute
-	 * in the secondary attributes category of a gameplay system.
+	 * @brief A collection of tags used to define gameplay-specific attributes or states.
 	 *
-	 * This tag is commonly used to identify and manage references, properties,
-	 * or effects related to the maximum mana stat within the game's mechanics.
-	 */
-	FGameplayTag Attributes_Secondary_MaxMana;
-	/**
-	 * A gameplay tag that represents the secondary attribute for maximum health.
-	 * This tag is used to identify and manage functionality related to the
-	 * maximum health secondary attribute in the gameplay system.
+	 * GameplayTags are typically utilized to represent metadata, categorize objects, or
+	 * define component or actor-specific properties within a game engine. They enable
+	 * efficient and flexible tagging systems to determine gameplay logic, features, or
+	 * behavior triggering mechanisms. Often used for improving modularity and reducing
+	 * hardcoded dependencies between gameplay systems.
 	 */
-	FGameplayTag Attributes_Secondary_MaxHealth;
+	static FAuraGameplayTags GameplayTags;
 
 	/**
-	 * Represents the gameplay tag associated with the left mouse button (LMB) input.
-	 * Used for binding or recognizing specific gameplay mechanics or actions triggered by the LMB.
+	 * @brief Checks that every row of the table was registered and that no tag name appears twice, then builds the
+	 * index lookups and descendant masks.
 	 */
-	FGameplayTag InputTag_LMB;
-	/**
-	 * @brief Variable to store the input tag for the Right Mouse Button (RMB) event.
-	 *
-	 * This variable is used to identify and manage input events specifically triggered
-	 * by the right mouse button in the application. It may be used within event handling
-	 * mechanisms or for mapping actions to the RMB input.
-	 */
-	FGameplayTag InputTag_RMB;
+	static void ValidateAndIndexNativeGameplayTags();
+
 	/**
-	 * @brief Represents the first input tag for a specific operation or process.
-	 *
-	 * This variable is typically used to identify or define the primary input
-	 * parameter required to execute a function, method, or operation. It may
-	 * serve as a unique identifier or a data source reference for the process.
-	 *
-	 * Usage and intended value of this variable depend on the context in which
-	 * it is applied.
+	 * The native tags ordered by their Aura-local index.
 	 */
-	FGameplayTag InputTag_1;
+	FGameplayTag TagsByIndex[FAuraGameplayTagBitSet::NumTags];
+
 	/**
-	 * @brief Represents a specific input tag used for identifying or categorizing
-	 *        a secondary input in the application.
-	 *
-	 * This variable is utilized to distinguish an input source or to provide
-	 * additional context for the system's input handling logic. It may be used
-	 * for tasks such as data processing, filtering, or routing specific
-	 * actions to a particular input stream.
+	 * For every native tag, the bitset of the tag itself and all native tags below it.
 	 */
-	FGameplayTag InputTag_2;
+	FAuraGameplayTagBitSet SelfAndDescendantMasks[FAuraGameplayTagBitSet::NumTags];
+
 	/**
-	 * @brief Represents the third input tag utilized in the system.
-	 *
-	 * The `InputTag_3` variable is used for managing and processing a specific
-	 * input in the application. It serves as an identifier or placeholder
-	 * for data associated with the third input, ensuring a consistent reference
-	 * within the system's logic.
-	 *
-	 * This variable plays a role in configurations, data pipelines, or workflows
-	 * where multiple input tags are involved, designated by sequential numbering.
+	 * Reverse lookup from a registered tag to its Aura-local index.
 	 */
-	FGameplayTag InputTag_3;
+	TMap<FGameplayTag, EAuraGameplayTag> IndicesByTag;
+
 	/**
-	 * @brief Represents the fourth input tag used for identifying or categorizing a specific input in the system.
-	 *
-	 * This variable is utilized to store or reference the fourth input tag in a sequential process or tagging system.
-	 * It may be used to track, label, or manage data relevant to a specific input. The context and value of InputTag_4
-	 * depend on its application in the program.
+	 * For every registered tag, the native tags it matches. See GetNativeAncestors.
 	 */
-	FGameplayTag InputTag_4;
+	TMap<FGameplayTag, FAuraGameplayTagBitSet> NativeAncestorsByTag;
 
-private:
 	/**
-	 * @brief A collection of tags used to define gameplay-specific attributes or states.
-	 *
-	 * GameplayTags are typically utilized to represent metadata, categorize objects, or
-	 * define component or actor-specific properties within a game engine. They enable
-	 * efficient and flexible tagging systems to determine gameplay logic, features, or
-	 * behavior triggering mechanisms. Often used for improving modularity and reducing
-	 * hardcoded dependencies between gameplay systems.
+	 * @brief Computes the native tags a gameplay tag matches by walking its parents.
 	 */
-	static FAuraGameplayTags GameplayTags;
+	static FAuraGameplayTagBitSet CompileNativeAncestors(const FGameplayTag& Tag);
 };
+
+inline bool FAuraGameplayTagBitSet::HasTag(EAuraGameplayTag Parent) const
+{
+	return HasAny(FAuraGameplayTags::GetSelfAndDescendants(Parent));
+}
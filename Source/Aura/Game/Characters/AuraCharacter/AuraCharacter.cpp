@@ -8,6 +8,7 @@
 #include "Aura/Game/Characters/PlayerController/AuraPlayerController.h"
 #include "Aura/Game/Characters/PlayerState/AuraPlayerState.h"
 #include "Aura/Game/UI/HUD/AuraHUD.h"
+#include "Game/Profiling/AuraStartupProfiler.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
 AAuraCharacter::AAuraCharacter()
@@ -29,8 +30,12 @@ void AAuraCharacter::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
 
+	FAuraStartupProfiler::MarkPhase(TEXT("PossessedBy"));
+
 	// Init ability actor info for the server
 	InitAbilityActorInfo();
+	// Default attributes are applied on the server only, clients receive the resulting values through replication.
+	InitializeDefaultAttributes();
 	AddCharacterAbilities();
 }
 
@@ -38,6 +43,8 @@ void AAuraCharacter::OnRep_PlayerState()
 {
 	Super::OnRep_PlayerState();
 
+	FAuraStartupProfiler::MarkPhase(TEXT("OnRep_PlayerState"));
+
 	// Init ability actor info for the client
 	InitAbilityActorInfo();
 }
@@ -46,6 +53,8 @@ void AAuraCharacter::InitAbilityActorInfo()
 {
 	Super::InitAbilityActorInfo();
 
+	FAuraStartupProfiler::MarkPhase(TEXT("InitAbilityActorInfo"));
+
 	if (AAuraPlayerState* AuraPlayerState = GetPlayerState<AAuraPlayerState>(); IsValid(AuraPlayerState))
 	{
 		AuraPlayerState->GetAbilitySystemComponent()->InitAbilityActorInfo(AuraPlayerState, this);
@@ -62,7 +71,6 @@ void AAuraCharacter::InitAbilityActorInfo()
 			}
 		}
 	}
-	InitializeDefaultAttributes();
 }
 
 int32 AAuraCharacter::GetPlayerLevel()
@@ -5,8 +5,18 @@
 
 #include "Aura/Game/AbilitySystem/AuraAbilitySystemComponent.h"
 #include "Aura/Game/AbilitySystem/AttributeSet/AuraAttributeSet.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Game/Networking/AuraNetRelevancySubsystem.h"
+#include "Game/Networking/AuraReplicationGraph.h"
+#include "Game/Significance/AuraEnemySignificanceSubsystem.h"
+#include "Game/Significance/AuraSignificancePolicy.h"
+#include "Game/UI/HealthBar/AuraEnemyHealthBarSubsystem.h"
+#include "Game/UI/Widget/AuraHealthBarWidget.h"
 
-AAuraEnemy::AAuraEnemy()
+AAuraEnemy::AAuraEnemy(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer
+		.DoNotCreateDefaultSubobject(SpringArmComponentName)
+		.DoNotCreateDefaultSubobject(CameraComponentName))
 {
 	GetMesh()->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
 
@@ -22,6 +32,26 @@ void AAuraEnemy::BeginPlay()
 	Super::BeginPlay();
 	SetMeshes();
 	InitAbilityActorInfo();
+
+	if (UAuraEnemySignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UAuraEnemySignificanceSubsystem>())
+	{
+		SignificanceSubsystem->RegisterEnemy(this);
+	}
+}
+
+void AAuraEnemy::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAuraEnemyHealthBarSubsystem* HealthBarSubsystem = GetWorld()->GetSubsystem<UAuraEnemyHealthBarSubsystem>())
+	{
+		HealthBarSubsystem->UnregisterEnemy(this);
+	}
+
+	if (UAuraEnemySignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UAuraEnemySignificanceSubsystem>())
+	{
+		SignificanceSubsystem->UnregisterEnemy(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AAuraEnemy::InitAbilityActorInfo()
@@ -29,10 +59,181 @@ void AAuraEnemy::InitAbilityActorInfo()
 	if (AbilitySystemComponent)
 	{
 		AbilitySystemComponent->InitAbilityActorInfo(this, this);
-		Cast<UAuraAbilitySystemComponent>(AbilitySystemComponent)->AbilityActorInfoSet();
+		UAuraAbilitySystemComponent* AuraASC = Cast<UAuraAbilitySystemComponent>(AbilitySystemComponent);
+		AuraASC->AbilityActorInfoSet();
+
+		if (HasAuthority())
+		{
+			AuraASC->OnReplicatedActivity.AddUObject(this, &AAuraEnemy::WakeFromDormancy);
+			WakeFromDormancy();
+		}
+
+		// Not created on dedicated servers, which never display health bars.
+		if (UAuraEnemyHealthBarSubsystem* HealthBarSubsystem = GetWorld()->GetSubsystem<UAuraEnemyHealthBarSubsystem>())
+		{
+			HealthBarSubsystem->RegisterEnemy(this);
+		}
 	}
 }
 
+void AAuraEnemy::DeactivateForPool()
+{
+	// The hidden state has to reach clients before the enemy may go dormant.
+	WakeFromDormancy();
+
+	if (UAuraEnemyHealthBarSubsystem* HealthBarSubsystem = GetWorld()->GetSubsystem<UAuraEnemyHealthBarSubsystem>())
+	{
+		HealthBarSubsystem->UnregisterEnemy(this);
+	}
+
+	if (IsValid(AbilitySystemComponent))
+	{
+		AbilitySystemComponent->CancelAllAbilities();
+		AbilitySystemComponent->ClearAllAbilities();
+
+		// An empty query matches every active effect.
+		for (const FActiveGameplayEffectHandle& EffectHandle : AbilitySystemComponent->GetActiveEffects(FGameplayEffectQuery()))
+		{
+			AbilitySystemComponent->RemoveActiveGameplayEffect(EffectHandle);
+		}
+
+		// Whatever is left after the effects are gone was added as a loose tag.
+		FGameplayTagContainer L_RemainingTags;
+		AbilitySystemComponent->GetOwnedGameplayTags(L_RemainingTags);
+		for (const FGameplayTag& Tag : L_RemainingTags)
+		{
+			AbilitySystemComponent->SetLooseGameplayTagCount(Tag, 0);
+		}
+	}
+
+	ToggleActorHighlighting(false);
+
+	if (UCharacterMovementComponent* L_MovementComponent = GetCharacterMovement(); IsValid(L_MovementComponent))
+	{
+		L_MovementComponent->StopMovementImmediately();
+		L_MovementComponent->Deactivate();
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+}
+
+void AAuraEnemy::ReactivateFromPool(const FTransform& SpawnTransform)
+{
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+
+	if (UCharacterMovementComponent* L_MovementComponent = GetCharacterMovement(); IsValid(L_MovementComponent))
+	{
+		L_MovementComponent->Activate(true);
+		L_MovementComponent->SetMovementMode(L_MovementComponent->DefaultLandMovementMode);
+	}
+
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(PrimaryActorTick.bStartWithTickEnabled);
+	WakeFromDormancy();
+
+	if (IsValid(AbilitySystemComponent))
+	{
+		AbilitySystemComponent->RefreshAbilityActorInfo();
+
+		if (UAuraEnemyHealthBarSubsystem* HealthBarSubsystem = GetWorld()->GetSubsystem<UAuraEnemyHealthBarSubsystem>())
+		{
+			HealthBarSubsystem->RegisterEnemy(this);
+		}
+	}
+}
+
+void AAuraEnemy::InitializeCombatDefaults()
+{
+	InitializeDefaultAttributes();
+	AddCharacterAbilities();
+}
+
+bool AAuraEnemy::PreloadCombatDefaults()
+{
+	PreloadCharacterAssets();
+	return AreCharacterAssetsLoaded();
+}
+
+void AAuraEnemy::ApplySignificanceTier(const FAuraSignificanceTier& Tier)
+{
+	if (HasAuthority())
+	{
+		UAuraReplicationGraph::SetNetUpdateFrequency(this, Tier.NetUpdateFrequency);
+	}
+
+	if (IsValid(AbilitySystemComponent))
+	{
+		AbilitySystemComponent->SetComponentTickInterval(Tier.AbilitySystemTickInterval);
+	}
+
+	for (USkeletalMeshComponent* SkeletalMesh : { BodyMesh.Get(), WeaponMesh.Get() })
+	{
+		if (IsValid(SkeletalMesh))
+		{
+			SkeletalMesh->SetComponentTickInterval(Tier.MeshTickInterval);
+			SkeletalMesh->VisibilityBasedAnimTickOption = Tier.VisibilityBasedAnimTickOption;
+		}
+	}
+}
+
+void AAuraEnemy::WakeFromDormancy()
+{
+	if (!HasAuthority() || DormancyIdleTime <= 0.f)
+	{
+		return;
+	}
+
+	LastReplicatedActivityTime = GetWorld()->GetTimeSeconds();
+
+	if (NetDormancy > DORM_Awake)
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+
+	if (!GetWorldTimerManager().IsTimerActive(DormancyTimerHandle))
+	{
+		GetWorldTimerManager().SetTimer(DormancyTimerHandle, this, &AAuraEnemy::CheckDormancy, DormancyIdleTime);
+	}
+}
+
+void AAuraEnemy::CheckDormancy()
+{
+	// Movement replicates through the actor rather than the ability system, so a moving enemy counts as active.
+	if (!GetVelocity().IsNearlyZero())
+	{
+		LastReplicatedActivityTime = GetWorld()->GetTimeSeconds();
+	}
+
+	const double L_IdleTime = GetWorld()->GetTimeSeconds() - LastReplicatedActivityTime;
+	if (L_IdleTime < DormancyIdleTime)
+	{
+		GetWorldTimerManager().SetTimer(DormancyTimerHandle, this, &AAuraEnemy::CheckDormancy, DormancyIdleTime - L_IdleTime);
+		return;
+	}
+
+	SetNetDormancy(DORM_DormantAll);
+}
+
+bool AAuraEnemy::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	if (bAlwaysRelevant || IsOwnedBy(ViewTarget) || IsOwnedBy(RealViewer) || this == ViewTarget || ViewTarget == GetInstigator())
+	{
+		return true;
+	}
+
+	bool bRelevant = false;
+	if (const UAuraNetRelevancySubsystem* RelevancySubsystem = GetWorld()->GetSubsystem<UAuraNetRelevancySubsystem>();
+		IsValid(RelevancySubsystem) && RelevancySubsystem->IsRelevantForViewer(RealViewer, GetActorLocation(), bRelevant))
+	{
+		return bRelevant;
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
+
 void AAuraEnemy::ToggleActorHighlighting(const bool bIsHighlight) const
 {
 	if (IsValid(BodyMesh) && IsValid(WeaponMesh))
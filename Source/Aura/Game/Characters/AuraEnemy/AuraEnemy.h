@@ -7,6 +7,9 @@
 #include "Aura/Game/Interaction/EnemyInterface.h"
 #include "AuraEnemy.generated.h"
 
+class UAuraHealthBarWidget;
+struct FAuraSignificanceTier;
+
 /**
  * Represents an enemy character in the Aura game, inheriting base character functionalities and implementing enemy-specific behavior.
  */
@@ -20,11 +23,13 @@ public:
 	 *
 	 * Initializes the enemy character by setting up the mesh collision responses,
 	 * creating the ability system component, and attribute set, and configuring
-	 * their replication settings.
+	 * their replication settings. Enemies never use a camera, so the spring arm and
+	 * camera of the base class are not created.
 	 *
+	 * @param ObjectInitializer The initializer passed on to the base class.
 	 * @return An instance of AAuraEnemy with the default property configurations.
 	 */
-	AAuraEnemy();
+	AAuraEnemy(const FObjectInitializer& ObjectInitializer);
 
 	/**
 	 * Toggles the highlighting effect on the actor's meshes by enabling or disabling the custom depth rendering
@@ -59,6 +64,76 @@ public:
 	 * @return The player's current level as an integer.
 	 */
 	virtual int32 GetPlayerLevel() override;
+
+	/**
+	 * Returns the widget class used for this enemy's health bar, or nullptr if the enemy shows no health bar.
+	 */
+	TSubclassOf<UAuraHealthBarWidget> GetHealthBarWidgetClass() const { return HealthBarWidgetClass; }
+
+	/**
+	 * Returns the offset of the health bar relative to the enemy's root component.
+	 */
+	FVector GetHealthBarOffset() const { return HealthBarOffset; }
+
+	/**
+	 * @brief Takes the enemy out of play so UAuraEnemyPoolSubsystem can reuse it.
+	 *
+	 * Releases the health bar, cancels and clears all granted abilities, removes all active effects and loose tags,
+	 * then hides the actor and disables its collision, movement and tick. Attributes are restored on reactivation.
+	 */
+	void DeactivateForPool();
+
+	/**
+	 * @brief Brings a pooled enemy back into play at the given transform.
+	 *
+	 * Only refreshes the ability actor info instead of re-running InitAbilityActorInfo, since the ability system
+	 * component and its bindings survived the pooling.
+	 *
+	 * @param SpawnTransform The transform the enemy is teleported to.
+	 */
+	void ReactivateFromPool(const FTransform& SpawnTransform);
+
+	/**
+	 * @brief Applies the default attribute effects and grants the startup abilities.
+	 *
+	 * Kept out of BeginPlay so that UAuraWaveSpawnerSubsystem can run it in a later frame than the actor spawn.
+	 * UAuraEnemyPoolSubsystem::AcquireEnemy runs it for every enemy it hands out, unless the caller defers it.
+	 * Only has an effect with authority.
+	 */
+	void InitializeCombatDefaults();
+
+	/**
+	 * @brief Starts streaming in the assets InitializeCombatDefaults needs, if they are not loaded yet.
+	 *
+	 * @return True once the assets are loaded, so that InitializeCombatDefaults completes synchronously.
+	 */
+	bool PreloadCombatDefaults();
+
+	/**
+	 * @brief Applies the update settings of a significance tier chosen by UAuraEnemySignificanceSubsystem.
+	 *
+	 * The net update frequency is only set with authority. The tick intervals and animation tick option are set
+	 * on every machine.
+	 *
+	 * @param Tier The tier the enemy now belongs to.
+	 */
+	void ApplySignificanceTier(const FAuraSignificanceTier& Tier);
+
+	/**
+	 * @brief Takes the enemy out of net dormancy and restarts its idle countdown.
+	 *
+	 * Called on the server for every replicated change of the ability system component, see
+	 * UAuraAbilitySystemComponent::OnReplicatedActivity. AI code calls it when the enemy gains aggro, before the
+	 * enemy starts moving. Does nothing on clients or when DormancyIdleTime is 0.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Replication")
+	void WakeFromDormancy();
+
+	/**
+	 * Restricts relevancy to connections whose top-down view contains the enemy, see UAuraNetRelevancySubsystem.
+	 */
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+
 protected:
 
 	/**
@@ -67,6 +142,11 @@ protected:
 	 */
 	virtual void BeginPlay() override;
 
+	/**
+	 * Unregisters the enemy from the health bar subsystem so its pooled health bar is released before the actor goes away.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/**
 	 * Initializes the ability system component by associating it with the current enemy instance.
 	 * Sets up ability actor information required for the ability system functionality and triggers
@@ -81,6 +161,26 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Character Class Defaults")
 	int32 Level = 1;
 
+	/**
+	 * The widget class of the health bar shown above this enemy while it is on screen.
+	 * Health bars are pooled and updated by UAuraEnemyHealthBarSubsystem. Leave empty to show no health bar.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UI")
+	TSubclassOf<UAuraHealthBarWidget> HealthBarWidgetClass = nullptr;
+
+	/**
+	 * Offset of the health bar relative to the enemy's root component.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UI")
+	FVector HealthBarOffset = FVector(0.f, 0.f, 120.f);
+
+	/**
+	 * Time in seconds without any attribute, tag, effect or ability change and without movement, after which the
+	 * enemy enters net dormancy. Dormant enemies are skipped by the server's property comparison. 0 keeps the enemy awake.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Replication")
+	float DormancyIdleTime = 5.f;
+
 	/**
 	 * Represents the skeletal mesh component used for the enemy's weapon.
 	 * This mesh defines the visual representation and animations associated with the equipped weapon.
@@ -94,4 +194,20 @@ protected:
 	 */
 	UPROPERTY()
 	TObjectPtr<class USkeletalMeshComponent> BodyMesh = nullptr;
+
+private:
+	/**
+	 * Puts the enemy into net dormancy if it stayed idle for DormancyIdleTime, or waits for the remaining time otherwise.
+	 */
+	void CheckDormancy();
+
+	/**
+	 * Fires CheckDormancy once the idle time of the last activity has passed.
+	 */
+	FTimerHandle DormancyTimerHandle;
+
+	/**
+	 * World time of the last replicated activity.
+	 */
+	double LastReplicatedActivityTime = 0.0;
 };
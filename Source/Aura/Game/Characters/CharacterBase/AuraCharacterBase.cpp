@@ -5,19 +5,35 @@
 
 #include "AbilitySystemComponent.h"
 #include "Camera/CameraComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "GameplayEffectAggregator.h"
+#include "Game/AuraAssetManager.h"
 #include "Game/AbilitySystem/AuraAbilitySystemComponent.h"
+#include "Game/AbilitySystem/Abilities/AuraGameplayAbility.h"
+#include "Game/Profiling/AuraStartupProfiler.h"
 #include "GameFramework/SpringArmComponent.h"
 
+const FName AAuraCharacterBase::SpringArmComponentName(TEXT("SpringArm"));
+const FName AAuraCharacterBase::CameraComponentName(TEXT("Camera"));
+
 // Sets default values
-AAuraCharacterBase::AAuraCharacterBase()
+AAuraCharacterBase::AAuraCharacterBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
 	PrimaryActorTick.bCanEverTick = false;
 
-	SpringArmComponent = CreateDefaultSubobject<USpringArmComponent>("SpringArm");
-	SpringArmComponent->SetupAttachment(GetMesh());
+	SpringArmComponent = CreateOptionalDefaultSubobject<USpringArmComponent>(SpringArmComponentName);
+	if (SpringArmComponent)
+	{
+		SpringArmComponent->SetupAttachment(GetMesh());
+	}
 
-	CameraComponent = CreateDefaultSubobject<UCameraComponent>("Camera");
-	CameraComponent->SetupAttachment(SpringArmComponent);
+	CameraComponent = CreateOptionalDefaultSubobject<UCameraComponent>(CameraComponentName);
+	if (CameraComponent)
+	{
+		CameraComponent->SetupAttachment(SpringArmComponent ? SpringArmComponent.Get() : GetMesh());
+	}
 
 	Weapon = CreateDefaultSubobject<USkeletalMeshComponent>("Weapon");
 	Weapon->SetupAttachment(GetMesh(), FName("WeaponHandSocket"));
@@ -28,7 +44,11 @@ AAuraCharacterBase::AAuraCharacterBase()
 void AAuraCharacterBase::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	WeaponBoneTransformsFinalizedHandle = Weapon->RegisterOnBoneTransformsFinalizedDelegate(
+		FOnBoneTransformsFinalizedMultiCast::FDelegate::CreateUObject(this, &AAuraCharacterBase::OnWeaponBoneTransformsFinalized));
+
+	PreloadCharacterAssets();
 }
 
 UAbilitySystemComponent* AAuraCharacterBase::GetAbilitySystemComponent() const
@@ -38,14 +58,61 @@ UAbilitySystemComponent* AAuraCharacterBase::GetAbilitySystemComponent() const
 
 FVector AAuraCharacterBase::GetCombatSocketLocation()
 {
-	return Weapon->GetSocketLocation(WeaponTipSocketName);
+	if (CombatSocketCache.Mesh != Weapon->GetSkeletalMeshAsset() || CombatSocketCache.SocketName != WeaponTipSocketName)
+	{
+		ResolveCombatSocket();
+	}
+
+	// Followers of a leader pose component have no component space transforms of their own.
+	const TArray<FTransform>& L_ComponentSpaceTransforms = Weapon->GetComponentSpaceTransforms();
+	if (!L_ComponentSpaceTransforms.IsValidIndex(CombatSocketCache.BoneIndex))
+	{
+		return Weapon->GetSocketLocation(WeaponTipSocketName);
+	}
+
+	if (!CombatSocketCache.bComponentTransformValid)
+	{
+		CombatSocketCache.SocketComponentTransform = CombatSocketCache.SocketLocalTransform * L_ComponentSpaceTransforms[CombatSocketCache.BoneIndex];
+
+		// Without the delegate nothing would invalidate the transform, so it is recomputed on every query until BeginPlay.
+		CombatSocketCache.bComponentTransformValid = WeaponBoneTransformsFinalizedHandle.IsValid();
+	}
+
+	return Weapon->GetComponentTransform().TransformPosition(CombatSocketCache.SocketComponentTransform.GetLocation());
+}
+
+void AAuraCharacterBase::OnWeaponBoneTransformsFinalized()
+{
+	CombatSocketCache.bComponentTransformValid = false;
+}
+
+void AAuraCharacterBase::ResolveCombatSocket()
+{
+	const USkeletalMesh* L_Mesh = Weapon->GetSkeletalMeshAsset();
+
+	CombatSocketCache = FCombatSocketCache();
+	CombatSocketCache.Mesh = L_Mesh;
+	CombatSocketCache.SocketName = WeaponTipSocketName;
+
+	if (L_Mesh == nullptr || WeaponTipSocketName.IsNone())
+	{
+		return;
+	}
+
+	int32 L_SocketIndex = INDEX_NONE;
+	if (L_Mesh->FindSocketInfo(WeaponTipSocketName, CombatSocketCache.SocketLocalTransform, CombatSocketCache.BoneIndex, L_SocketIndex) == nullptr)
+	{
+		// Not a socket, the name may still be a bone.
+		CombatSocketCache.SocketLocalTransform = FTransform::Identity;
+		CombatSocketCache.BoneIndex = Weapon->GetBoneIndex(WeaponTipSocketName);
+	}
 }
 
 void AAuraCharacterBase::InitAbilityActorInfo()
 {
 }
 
-void AAuraCharacterBase::ApplyEffectToSelf(TSubclassOf<UGameplayEffect> GameplayEffectClass, float Level) const
+FActiveGameplayEffectHandle AAuraCharacterBase::ApplyEffectToSelf(TSubclassOf<UGameplayEffect> GameplayEffectClass, float Level) const
 {
 	if (UAbilitySystemComponent* L_AbilitySystemComponent = GetAbilitySystemComponent();
 		IsValid(L_AbilitySystemComponent) && IsValid(GameplayEffectClass))
@@ -54,23 +121,143 @@ void AAuraCharacterBase::ApplyEffectToSelf(TSubclassOf<UGameplayEffect> Gameplay
 		ContextHandle.AddSourceObject(this);
 		const FGameplayEffectSpecHandle SpecHandle = L_AbilitySystemComponent->MakeOutgoingSpec(GameplayEffectClass, Level, ContextHandle);
 
-		L_AbilitySystemComponent->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(),  L_AbilitySystemComponent);
+		return L_AbilitySystemComponent->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(),  L_AbilitySystemComponent);
 	}
+
+	return FActiveGameplayEffectHandle();
 }
 
-void AAuraCharacterBase::InitializeDefaultAttributes() const
+void AAuraCharacterBase::InitializeDefaultAttributes()
 {
-	ApplyEffectToSelf(DefaultPrimaryAttributes, 1.f);
-	ApplyEffectToSelf(DefaultSecondaryAttributes, 1.f);
-	ApplyEffectToSelf(DefaultVitalAttributes, 1.f);
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	CallWhenCharacterAssetsLoaded(FSimpleDelegate::CreateUObject(this, &AAuraCharacterBase::ApplyDefaultAttributes));
 }
 
 void AAuraCharacterBase::AddCharacterAbilities()
 {
 	if (HasAuthority())
 	{
-		UAuraAbilitySystemComponent* AuraASC = CastChecked<UAuraAbilitySystemComponent>(AbilitySystemComponent);
+		CallWhenCharacterAssetsLoaded(FSimpleDelegate::CreateUObject(this, &AAuraCharacterBase::GiveStartupAbilities));
+	}
+}
+
+void AAuraCharacterBase::PreloadCharacterAssets()
+{
+	if (bCharacterAssetsRequested)
+	{
+		return;
+	}
+	bCharacterAssetsRequested = true;
+
+	TArray<FSoftObjectPath> L_ClassesToLoad;
+	L_ClassesToLoad.Reserve(StartupAbilities.Num() + 3);
+	L_ClassesToLoad.Add(DefaultPrimaryAttributes.ToSoftObjectPath());
+	L_ClassesToLoad.Add(DefaultSecondaryAttributes.ToSoftObjectPath());
+	L_ClassesToLoad.Add(DefaultVitalAttributes.ToSoftObjectPath());
+	for (const TSoftClassPtr<UGameplayAbility>& AbilityClass : StartupAbilities)
+	{
+		L_ClassesToLoad.Add(AbilityClass.ToSoftObjectPath());
+	}
+
+	CharacterClassesHandle = UAuraAssetManager::Get().LoadGameplayAssetsAsync(L_ClassesToLoad,
+		FStreamableDelegate::CreateUObject(this, &AAuraCharacterBase::OnCharacterClassesLoaded));
+}
+
+void AAuraCharacterBase::CallWhenCharacterAssetsLoaded(FSimpleDelegate Callback)
+{
+	if (bCharacterAssetsLoaded)
+	{
+		Callback.ExecuteIfBound();
+		return;
+	}
+
+	PendingCharacterAssetCallbacks.Add(MoveTemp(Callback));
+	PreloadCharacterAssets();
+}
+
+void AAuraCharacterBase::ApplyDefaultAttributes()
+{
+	{
+		// Secondary attributes are derived from the primary ones. Batching the aggregator updates evaluates each
+		// secondary attribute once, after both effects are applied, instead of after every single primary change.
+		FScopedAggregatorOnDirtyBatch L_AggregatorBatch;
+
+		ApplyEffectToSelf(DefaultPrimaryAttributes.Get(), 1.f);
+		// At the character level, which the magnitude calculations of the secondary attributes read. The effect
+		// follows the character level from then on, other effects keep the level they were applied at.
+		const FActiveGameplayEffectHandle L_SecondaryHandle = ApplyEffectToSelf(DefaultSecondaryAttributes.Get(), static_cast<float>(GetPlayerLevel()));
+		if (UAuraAbilitySystemComponent* L_AuraASC = Cast<UAuraAbilitySystemComponent>(GetAbilitySystemComponent()))
+		{
+			L_AuraASC->AddLevelDependentEffect(L_SecondaryHandle);
+		}
+	}
+
+	// Outside the batch: Health and Mana are clamped to MaxHealth and MaxMana, which only hold their values once the
+	// batch has flushed the secondary aggregators.
+	ApplyEffectToSelf(DefaultVitalAttributes.Get(), 1.f);
+
+	// Only moves the owner's next net update to this frame, the attributes still replicate as regular properties.
+	if (const UAbilitySystemComponent* L_AbilitySystemComponent = GetAbilitySystemComponent(); IsValid(L_AbilitySystemComponent))
+	{
+		if (AActor* L_OwnerActor = L_AbilitySystemComponent->GetOwner())
+		{
+			L_OwnerActor->ForceNetUpdate();
+		}
+	}
+}
+
+void AAuraCharacterBase::GiveStartupAbilities()
+{
+	TArray<TSubclassOf<UGameplayAbility>> L_StartupAbilities;
+	L_StartupAbilities.Reserve(StartupAbilities.Num());
+	for (const TSoftClassPtr<UGameplayAbility>& AbilityClass : StartupAbilities)
+	{
+		if (UClass* L_AbilityClass = AbilityClass.Get())
+		{
+			L_StartupAbilities.Add(L_AbilityClass);
+		}
+	}
+
+	UAuraAbilitySystemComponent* AuraASC = CastChecked<UAuraAbilitySystemComponent>(AbilitySystemComponent);
+
+	AuraASC->AddCharacterAbilities(L_StartupAbilities);
+}
+
+void AAuraCharacterBase::OnCharacterClassesLoaded()
+{
+	TArray<FSoftObjectPath> L_AssetsToLoad;
+	for (const TSoftClassPtr<UGameplayAbility>& AbilityClass : StartupAbilities)
+	{
+		if (const UClass* L_AbilityClass = AbilityClass.Get())
+		{
+			if (const UAuraGameplayAbility* L_AbilityCDO = Cast<UAuraGameplayAbility>(L_AbilityClass->GetDefaultObject()))
+			{
+				L_AbilityCDO->GetAssetsToPreload(L_AssetsToLoad);
+			}
+		}
+	}
+
+	CharacterAssetsHandle = UAuraAssetManager::Get().LoadGameplayAssetsAsync(L_AssetsToLoad,
+		FStreamableDelegate::CreateUObject(this, &AAuraCharacterBase::OnCharacterAssetsLoaded));
+}
+
+void AAuraCharacterBase::OnCharacterAssetsLoaded()
+{
+	bCharacterAssetsLoaded = true;
+
+	if (IsPlayerControlled())
+	{
+		FAuraStartupProfiler::MarkPhase(TEXT("CharacterAssetsLoaded"));
+	}
 
-		AuraASC->AddCharacterAbilities(StartupAbilities);
+	// Callbacks may queue further callbacks, which now execute right away instead.
+	TArray<FSimpleDelegate> L_Callbacks = MoveTemp(PendingCharacterAssetCallbacks);
+	for (const FSimpleDelegate& Callback : L_Callbacks)
+	{
+		Callback.ExecuteIfBound();
 	}
 }
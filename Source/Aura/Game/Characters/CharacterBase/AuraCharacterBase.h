@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "AbilitySystemInterface.h"
+#include "ActiveGameplayEffectHandle.h"
+#include "Engine/StreamableManager.h"
 #include "Aura/Game/Interaction/CombatInterface.h"
 #include "AuraCharacterBase.generated.h"
 
@@ -49,21 +51,23 @@ public:
 	 * Configures default settings like disabling actor ticking and disabling collision
 	 * for the Weapon component.
 	 *
+	 * The SpringArmComponent and CameraComponent are optional subobjects. Archetypes without a camera, like enemies,
+	 * skip them by passing DoNotCreateDefaultSubobject with SpringArmComponentName and CameraComponentName.
+	 *
+	 * @param ObjectInitializer The initializer, carrying the subobjects derived classes chose not to create.
 	 * @return A new instance of the AAuraCharacterBase class.
 	 */
-	AAuraCharacterBase();
+	AAuraCharacterBase(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
-protected:
 	/**
-	 * Called when the game starts or when the character is spawned.
-	 *
-	 * This method is an override of the AActor's `BeginPlay` function.
-	 * It serves as the entry point for initializing any game-related logic
-	 * specific to the Aura character after the character is instantiated
-	 * and just before gameplay begins. This allows for any setup that
-	 * requires the character and its components to exist in the game world.
+	 * Name of the optional spring arm subobject.
 	 */
-	virtual void BeginPlay() override;
+	static const FName SpringArmComponentName;
+
+	/**
+	 * Name of the optional camera subobject.
+	 */
+	static const FName CameraComponentName;
 
 	/**
 	 * Retrieves the Ability System Component associated with this character.
@@ -79,6 +83,24 @@ protected:
 	 */
 	class UAttributeSet* GetAttributeSet() const { return AttributeSet; }
 
+	/**
+	 * Returns whether the startup abilities, the default attribute effects and the ability assets are loaded, so
+	 * InitializeDefaultAttributes and AddCharacterAbilities take effect right away instead of being deferred.
+	 */
+	bool AreCharacterAssetsLoaded() const { return bCharacterAssetsLoaded; }
+
+protected:
+	/**
+	 * Called when the game starts or when the character is spawned.
+	 *
+	 * This method is an override of the AActor's `BeginPlay` function.
+	 * It serves as the entry point for initializing any game-related logic
+	 * specific to the Aura character after the character is instantiated
+	 * and just before gameplay begins. This allows for any setup that
+	 * requires the character and its components to exist in the game world.
+	 */
+	virtual void BeginPlay() override;
+
 protected:
 	/**
 	 * A SpringArmComponent that allows for flexible control of camera positioning and movement.
@@ -99,6 +121,7 @@ protected:
 	 *
 	 * Note:
 	 * To utilize this component, it must be correctly attached to the owning actor (e.g., a character).
+	 * Null for archetypes that do not create the camera rig, see SpringArmComponentName.
 	 */
 
 	UPROPERTY(EditAnywhere, Category="Camera")
@@ -109,6 +132,7 @@ protected:
 	 * It is used to define and control the camera behavior and properties for the character in the game.
 	 *
 	 * This property is editable in the editor and categorized under "Camera".
+	 * Null for archetypes that do not create the camera rig, see CameraComponentName.
 	 */
 	UPROPERTY(EditAnywhere, Category="Camera")
 	TObjectPtr<class UCameraComponent> CameraComponent = nullptr;
@@ -143,6 +167,10 @@ protected:
 	 * This method returns the world-space location of the specified combat socket on the character's weapon.
 	 * It is used for determining positions relevant to combat, such as attack origins or projectile spawning points.
 	 *
+	 * The socket is resolved to a bone index and bone relative transform once per weapon mesh. Its component space
+	 * transform is computed on the first query after the weapon finalizes its bone transforms, so further queries
+	 * against the same pose cost a single transform, and a query after a new pose never returns the old one.
+	 *
 	 * @return The FVector representing the world-space location of the combat socket.
 	 */
 	virtual FVector GetCombatSocketLocation() override;
@@ -183,9 +211,10 @@ protected:
 	 * This property is editable in the editor, exposed to Blueprints for read-only access, and is categorized under "Attributes".
 	 *
 	 * @note This variable should be set to a subclass of UGameplayEffect to ensure proper behavior.
+	 * It is a soft reference, streamed in by PreloadCharacterAssets.
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attributes")
-	TSubclassOf<class UGameplayEffect> DefaultPrimaryAttributes = nullptr;
+	TSoftClassPtr<class UGameplayEffect> DefaultPrimaryAttributes = nullptr;
 
 	/**
 	 * Represents the default secondary attribute set applied to the character.
@@ -200,7 +229,7 @@ protected:
 	 * while the edit anywhere property permits modification of its value in the editor.
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attributes")
-	TSubclassOf<class UGameplayEffect> DefaultSecondaryAttributes = nullptr;
+	TSoftClassPtr<class UGameplayEffect> DefaultSecondaryAttributes = nullptr;
 
 	/**
 	 * Represents the default gameplay effect associated with vital attributes for this character.
@@ -212,29 +241,36 @@ protected:
 	 * It is editable in the editor, can be read in blueprints, and is categorized under "Attributes".
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attributes")
-	TSubclassOf<class UGameplayEffect> DefaultVitalAttributes = nullptr;
+	TSoftClassPtr<class UGameplayEffect> DefaultVitalAttributes = nullptr;
 
 	/**
 	 * Applies a gameplay effect to the character itself.
 	 *
 	 * @param GameplayEffectClass The class of the gameplay effect to be applied.
 	 * @param Level The level of the gameplay effect, which determines its potency or strength.
+	 * @return The handle of the applied effect, invalid if it could not be applied or is instant.
 	 */
-	void ApplyEffectToSelf(TSubclassOf<UGameplayEffect> GameplayEffectClass, float Level) const;
+	FActiveGameplayEffectHandle ApplyEffectToSelf(TSubclassOf<UGameplayEffect> GameplayEffectClass, float Level) const;
 
 	/**
 	 * Initializes the default attributes for the character by applying predefined gameplay effect classes.
 	 *
 	 * This method applies three types of default attribute gameplay effects to the character: primary,
-	 * secondary, and vital attributes. Each effect is applied at a base level of 1.0. These gameplay effects
+	 * secondary, and vital attributes. The secondary effect is applied at the level from GetPlayerLevel, the others at
+	 * level 1.0. These gameplay effects
 	 * are defined as properties in the class and can be customized per character. The method is designed
 	 * to ensure that the character starts with its default attribute setup correctly initialized.
 	 *
 	 * @note This method is expected to be called during the initialization phase of the character, such as
 	 * in BeginPlay or other setup methods. It is crucial for ensuring the character's attribute system
-	 * has the required effects applied from the beginning.
+	 * has the required effects applied from the beginning. The effects are applied as soon as the character
+	 * assets are preloaded, right away if they already are.
+	 *
+	 * Only runs with authority. Clients do not apply the effects or run their magnitude calculations, they receive
+	 * the resulting attribute values through regular replication; the server calls ForceNetUpdate on the owner once
+	 * the effects are applied so that this happens in the next net update.
 	 */
-	void InitializeDefaultAttributes() const;
+	void InitializeDefaultAttributes();
 
 	/**
 	 * Adds gameplay abilities to the character. This method is invoked to bind
@@ -248,9 +284,120 @@ protected:
 	 * Prerequisites:
 	 * - The character must have an initialized AbilitySystemComponent.
 	 * - Authority (server-side) is required to make changes in abilities.
+	 *
+	 * The abilities are granted as soon as the character assets are preloaded, right away if they already are.
 	 */
 	void AddCharacterAbilities();
+
+	/**
+	 * @brief Starts streaming in the startup abilities, the default attribute effects and the ability assets.
+	 *
+	 * Loading happens in two steps: the ability and effect classes first, then whatever each loaded ability returns
+	 * from UAuraGameplayAbility::GetAssetsToPreload, like the class of a spawned projectile. Calling it again while
+	 * a preload is running or after it completed does nothing. Called from BeginPlay, and from the initialization
+	 * methods in case they run first.
+	 */
+	void PreloadCharacterAssets();
+
+	/**
+	 * @brief Executes the callback once the character assets are preloaded.
+	 *
+	 * Executes it right away if they already are, otherwise starts the preload if needed and queues the callback.
+	 *
+	 * @param Callback The callback to execute.
+	 */
+	void CallWhenCharacterAssetsLoaded(FSimpleDelegate Callback);
+
 private:
+	/**
+	 * Applies the default attribute effects. Expects them to be loaded.
+	 */
+	void ApplyDefaultAttributes();
+
+	/**
+	 * Grants the startup abilities to the ability system component. Expects them to be loaded.
+	 */
+	void GiveStartupAbilities();
+
+	/**
+	 * Called when the ability and effect classes are loaded. Requests the assets of the loaded abilities.
+	 */
+	void OnCharacterClassesLoaded();
+
+	/**
+	 * Called when the ability assets are loaded. Executes the queued callbacks.
+	 */
+	void OnCharacterAssetsLoaded();
+
+	/**
+	 * Handle of the ability and effect class load. Kept so the classes stay resident with the character.
+	 */
+	TSharedPtr<FStreamableHandle> CharacterClassesHandle;
+
+	/**
+	 * Handle of the ability asset load. Kept so the assets stay resident with the character.
+	 */
+	TSharedPtr<FStreamableHandle> CharacterAssetsHandle;
+
+	/**
+	 * Callbacks waiting for the preload to complete.
+	 */
+	TArray<FSimpleDelegate> PendingCharacterAssetCallbacks;
+
+	/**
+	 * Whether PreloadCharacterAssets was called.
+	 */
+	bool bCharacterAssetsRequested = false;
+
+	/**
+	 * Whether the preload completed.
+	 */
+	bool bCharacterAssetsLoaded = false;
+
+	/**
+	 * @brief The combat socket of the weapon, resolved once per mesh and socket name.
+	 */
+	struct FCombatSocketCache
+	{
+		/** The weapon mesh the socket was resolved for. */
+		TWeakObjectPtr<const USkeletalMesh> Mesh = nullptr;
+
+		/** The socket name the socket was resolved for. */
+		FName SocketName = NAME_None;
+
+		/** The bone the socket is attached to, INDEX_NONE if the name matches neither a socket nor a bone. */
+		int32 BoneIndex = INDEX_NONE;
+
+		/** The transform of the socket relative to its bone. */
+		FTransform SocketLocalTransform = FTransform::Identity;
+
+		/** Whether SocketComponentTransform matches the current pose of the weapon. */
+		bool bComponentTransformValid = false;
+
+		/** The transform of the socket in the weapon's component space. */
+		FTransform SocketComponentTransform = FTransform::Identity;
+	};
+
+	/**
+	 * Resolves WeaponTipSocketName on the current weapon mesh into CombatSocketCache.
+	 */
+	void ResolveCombatSocket();
+
+	/**
+	 * Invalidates the component space transform of the combat socket once the weapon has a new pose.
+	 */
+	void OnWeaponBoneTransformsFinalized();
+
+	/**
+	 * The handle of OnWeaponBoneTransformsFinalized on the weapon, registered in BeginPlay.
+	 */
+	FDelegateHandle WeaponBoneTransformsFinalizedHandle;
+
+	/**
+	 * The resolved combat socket.
+	 */
+	FCombatSocketCache CombatSocketCache;
+
 	/**
 	 * An array containing the gameplay ability classes that the character
 	 * starts with. These abilities will be added to the character upon initialization.
@@ -258,7 +405,8 @@ private:
 	 * This property is editable within the editor and categorized under "Abilities".
 	 * It is primarily used to define the default set of abilities available to the character
 	 * at the start of the game or whenever the abilities are initialized.
+	 * The classes are soft references, streamed in by PreloadCharacterAssets.
 	 */
 	UPROPERTY(EditAnywhere, Category="Abilities")
-	TArray<TSubclassOf<UGameplayAbility>> StartupAbilities;
+	TArray<TSoftClassPtr<UGameplayAbility>> StartupAbilities;
 };
@@ -14,7 +14,11 @@
 #include "Components/SplineComponent.h"
 #include "Game/AuraGameplayTags.h"
 #include "Game/AbilitySystem/AuraAbilitySystemComponent.h"
+#include "Game/AbilitySystem/AttributeSet/AuraAttributeSet.h"
 #include "Game/Input/AuraInputComponent.h"
+#include "Game/Profiling/AuraStartupProfiler.h"
+#include "Game/UI/HUD/AuraHUD.h"
+#include "Game/UI/WidgetController/AuraWidgetControllerSubsystem/AuraWidgetControllerSubsystem.h"
 
 AAuraPlayerController::AAuraPlayerController()
 {
@@ -23,6 +27,14 @@ AAuraPlayerController::AAuraPlayerController()
 	SplineComponent = CreateDefaultSubobject<USplineComponent>("SplineComponent");
 }
 
+void AAuraPlayerController::Client_ShowCombatText_Implementation(AActor* TargetActor, float Amount)
+{
+	if (AAuraHUD* AuraHUD = GetHUD<AAuraHUD>(); IsValid(AuraHUD))
+	{
+		AuraHUD->AddCombatText(TargetActor, Amount);
+	}
+}
+
 void AAuraPlayerController::BeginPlay()
 {
 	Super::BeginPlay();
@@ -47,6 +59,21 @@ void AAuraPlayerController::PlayerTick(float DeltaTime)
 {
 	Super::PlayerTick(DeltaTime);
 
+	if (FAuraStartupProfiler::IsEnabled() && IsLocalController())
+	{
+		// The player can act once the possessed pawn is the avatar of the ability system component, the asynchronously
+		// loaded abilities are granted, the default attributes are applied and the overlay is on screen.
+		const UAuraAbilitySystemComponent* L_ASC = GetAuraAbilitySystemComponent();
+		const AAuraHUD* L_AuraHUD = GetHUD<AAuraHUD>();
+		if (IsValid(L_ASC) && GetPawn() != nullptr && L_ASC->GetAvatarActor() == GetPawn()
+			&& !L_ASC->GetActivatableAbilities().IsEmpty()
+			&& L_ASC->GetNumericAttribute(UAuraAttributeSet::GetMaxHealthAttribute()) > 0.f
+			&& IsValid(L_AuraHUD) && L_AuraHUD->IsOverlayCreated())
+		{
+			FAuraStartupProfiler::MarkInteractive();
+		}
+	}
+
 	CursorTrace();
 
 	AutoRun();
@@ -79,6 +106,61 @@ void AAuraPlayerController::SetupInputComponent()
 	AuraInputComponent->BindAbilityActions(InputConfig, this, &ThisClass::AbilityInputTagPressed, &ThisClass::AbilityInputTagReleased, &ThisClass::AbilityInputTagHeld);
 }
 
+bool AAuraPlayerController::RebindAbilityInputAction(const UInputAction* InputAction, FGameplayTag NewInputTag)
+{
+	UAuraInputComponent* AuraInputComponent = Cast<UAuraInputComponent>(InputComponent);
+	if (!IsValid(AuraInputComponent) || InputAction == nullptr)
+	{
+		return false;
+	}
+
+	if (AuraInputComponent->GetBoundAbilityInputTag(InputAction) == NewInputTag)
+	{
+		return false;
+	}
+
+	if (!NewInputTag.IsValid())
+	{
+		return AuraInputComponent->UnbindAbilityAction(InputAction);
+	}
+
+	FAuraInputAction L_Action;
+	L_Action.InputAction = InputAction;
+	L_Action.InputTag = NewInputTag;
+	AuraInputComponent->BindAbilityAction(L_Action, this, &ThisClass::AbilityInputTagPressed, &ThisClass::AbilityInputTagReleased, &ThisClass::AbilityInputTagHeld);
+
+	return true;
+}
+
+void AAuraPlayerController::SetPawn(APawn* InPawn)
+{
+	Super::SetPawn(InPawn);
+
+	InvalidateWidgetControllerCache();
+}
+
+void AAuraPlayerController::InitPlayerState()
+{
+	Super::InitPlayerState();
+
+	InvalidateWidgetControllerCache();
+}
+
+void AAuraPlayerController::OnRep_PlayerState()
+{
+	Super::OnRep_PlayerState();
+
+	InvalidateWidgetControllerCache();
+}
+
+void AAuraPlayerController::InvalidateWidgetControllerCache() const
+{
+	if (UAuraWidgetControllerSubsystem* Subsystem = UAuraWidgetControllerSubsystem::Get(this))
+	{
+		Subsystem->InvalidateCache(GetLocalPlayer());
+	}
+}
+
 void AAuraPlayerController::Move(const FInputActionValue& InputActionValue)
 {
 	const FVector2d InputAxisVector = InputActionValue.Get<FVector2d>();
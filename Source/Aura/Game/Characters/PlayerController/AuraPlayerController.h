@@ -3,14 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
 #include "Aura/Game/Interaction/EnemyInterface.h"
 #include "GameFramework/PlayerController.h"
 #include "AuraPlayerController.generated.h"
 
 class USplineComponent;
 class UAuraAbilitySystemComponent;
-struct FGameplayTag;
 class UAuraInputConfig;
+class UInputAction;
 
 /**
  * A player controller class that extends APlayerController.
@@ -32,6 +33,30 @@ public:
 	 */
 	AAuraPlayerController();
 
+	/**
+	 * @brief Shows a floating damage or heal number on this player's HUD.
+	 *
+	 * Sent by the server from UAuraAttributeSet::PostGameplayEffectExecute to the player that caused and the player
+	 * that received a health change. Unreliable, a dropped number is preferable to queueing cosmetic traffic.
+	 *
+	 * @param TargetActor The actor whose health changed.
+	 * @param Amount The health change. Negative values are damage, positive values are healing.
+	 */
+	UFUNCTION(Client, Unreliable)
+	void Client_ShowCombatText(AActor* TargetActor, float Amount);
+
+	/**
+	 * @brief Remaps an ability input action to another input tag at runtime.
+	 *
+	 * Only the press, release and hold bindings of this input action are replaced, all other bindings stay untouched.
+	 *
+	 * @param InputAction An input action of the input config.
+	 * @param NewInputTag The input tag the action should send from now on. An empty tag unbinds the action.
+	 * @return True if the bindings changed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Input")
+	bool RebindAbilityInputAction(const UInputAction* InputAction, FGameplayTag NewInputTag);
+
 protected:
 	/**
 	 * This method is called when gameplay begins for the player controller.
@@ -70,7 +95,37 @@ protected:
 	 */
 	virtual void SetupInputComponent() override;
 
+	/**
+	 * Called on both the server and the owning client whenever this controller's pawn changes.
+	 *
+	 * Invalidates the cached widget controllers of the local player so that widgets resolve
+	 * their dependencies again for the newly possessed pawn.
+	 *
+	 * @param InPawn The pawn now controlled by this player controller, or nullptr when unpossessing.
+	 */
+	virtual void SetPawn(APawn* InPawn) override;
+
+	/**
+	 * Called on the server when the player state of this controller is created.
+	 *
+	 * Invalidates the cached widget controllers of the local player (listen server host).
+	 */
+	virtual void InitPlayerState() override;
+
+	/**
+	 * Called on the owning client when the player state of this controller is replicated.
+	 *
+	 * Invalidates the cached widget controllers of the local player, since they reference the previous player state.
+	 */
+	virtual void OnRep_PlayerState() override;
+
 private:
+	/**
+	 * Drops this player's entry from the UAuraWidgetControllerSubsystem cache.
+	 * Does nothing for controllers without a local player, such as remote players on the server.
+	 */
+	void InvalidateWidgetControllerCache() const;
+
 	/**
 	 * Handles movement input for the player character.
 	 *
@@ -5,7 +5,9 @@
 
 #include "Aura/Game/AbilitySystem/AuraAbilitySystemComponent.h"
 #include "Aura/Game/AbilitySystem/AttributeSet/AuraAttributeSet.h"
+#include "Aura/Game/Networking/AuraReplicationGraph.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 AAuraPlayerState::AAuraPlayerState()
 {
@@ -16,7 +18,37 @@ AAuraPlayerState::AAuraPlayerState()
 
 	AttributeSet = CreateDefaultSubobject<UAuraAttributeSet>("AttributeSet");
 
-	SetNetUpdateFrequency(100.f);
+	SetNetUpdateFrequency(IdleNetUpdateFrequency);
+	SetMinNetUpdateFrequency(IdleNetUpdateFrequency);
+}
+
+void AAuraPlayerState::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (HasAuthority())
+	{
+		// Blueprint subclasses may change the idle frequency after construction.
+		UAuraReplicationGraph::SetNetUpdateFrequency(this, IdleNetUpdateFrequency);
+		SetMinNetUpdateFrequency(IdleNetUpdateFrequency);
+
+		if (UAuraAbilitySystemComponent* AuraASC = Cast<UAuraAbilitySystemComponent>(AbilitySystemComponent))
+		{
+			AuraASC->OnReplicatedActivity.AddUObject(this, &AAuraPlayerState::RaiseNetUpdateFrequency);
+		}
+	}
+}
+
+void AAuraPlayerState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAuraAbilitySystemComponent* AuraASC = Cast<UAuraAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		AuraASC->OnReplicatedActivity.RemoveAll(this);
+	}
+
+	GetWorldTimerManager().ClearTimer(NetUpdateFrequencyDecayTimerHandle);
+
+	Super::EndPlay(EndPlayReason);
 }
 
 UAbilitySystemComponent* AAuraPlayerState::GetAbilitySystemComponent() const
@@ -28,9 +60,72 @@ void AAuraPlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(AAuraPlayerState, Level);
+	FDoRepLifetimeParams L_Params;
+	L_Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AAuraPlayerState, Level, L_Params);
+}
+
+void AAuraPlayerState::SetLevel(int32 InLevel)
+{
+	if (Level == InLevel)
+	{
+		return;
+	}
+
+	Level = InLevel;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AAuraPlayerState, Level, this);
+
+	if (UAuraAbilitySystemComponent* AuraASC = Cast<UAuraAbilitySystemComponent>(AbilitySystemComponent))
+	{
+		AuraASC->RefreshLevelDependentEffects(Level);
+	}
+
+	ForceNetUpdate();
+
+	OnLevelChanged.Broadcast(Level);
+}
+
+void AAuraPlayerState::RaiseNetUpdateFrequency()
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	LastReplicatedActivityTime = GetWorld()->GetTimeSeconds();
+
+	if (GetNetUpdateFrequency() < ActiveNetUpdateFrequency)
+	{
+		UAuraReplicationGraph::SetNetUpdateFrequency(this, ActiveNetUpdateFrequency);
+	}
+
+	// Only flags the actor for the next net tick, so a burst of changes in one frame still sends one update.
+	ForceNetUpdate();
+
+	if (!GetWorldTimerManager().IsTimerActive(NetUpdateFrequencyDecayTimerHandle))
+	{
+		GetWorldTimerManager().SetTimer(NetUpdateFrequencyDecayTimerHandle, this, &AAuraPlayerState::DecayNetUpdateFrequency,
+			NetUpdateFrequencyDecayInterval, true, ActiveNetUpdateHoldTime);
+	}
+}
+
+void AAuraPlayerState::DecayNetUpdateFrequency()
+{
+	if (GetWorld()->GetTimeSeconds() - LastReplicatedActivityTime < ActiveNetUpdateHoldTime)
+	{
+		return;
+	}
+
+	const float L_NetUpdateFrequency = FMath::Max(GetNetUpdateFrequency() * 0.5f, IdleNetUpdateFrequency);
+	UAuraReplicationGraph::SetNetUpdateFrequency(this, L_NetUpdateFrequency);
+
+	if (L_NetUpdateFrequency <= IdleNetUpdateFrequency)
+	{
+		GetWorldTimerManager().ClearTimer(NetUpdateFrequencyDecayTimerHandle);
+	}
 }
 
 void AAuraPlayerState::OnRep_Level(int32 OldLevel)
 {
+	OnLevelChanged.Broadcast(Level);
 }
@@ -7,6 +7,8 @@
 #include "GameFramework/PlayerState.h"
 #include "AuraPlayerState.generated.h"
 
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPlayerLevelChanged, int32 /*NewLevel*/);
+
 /**
  * AAuraPlayerState represents the PlayerState in the Aura project, which extends functionality
  * through the implementation of the Ability System Interface. It provides integration with an
@@ -21,8 +23,8 @@ class AURA_API AAuraPlayerState : public APlayerState, public IAbilitySystemInte
 	 * @brief Default constructor for the AAuraPlayerState class.
 	 *
 	 * This constructor initializes the AbilitySystemComponent and AttributeSet, setting up
-	 * the replicated AbilitySystemComponent with a mixed replication mode. It also sets the
-	 * network update frequency for this player state instance.
+	 * the replicated AbilitySystemComponent with a mixed replication mode. The player state starts at
+	 * IdleNetUpdateFrequency and is raised to ActiveNetUpdateFrequency on replicated activity.
 	 *
 	 * @return A new instance of the AAuraPlayerState class.
 	 */
@@ -63,7 +65,36 @@ public:
 	 */
 	FORCEINLINE int32 GetPLayerLevel() const { return Level; }
 
+	/**
+	 * @brief Sets the level of the player. Only call with authority.
+	 *
+	 * Runs the whole level change in one pass: marks Level dirty for replication, re-evaluates every level dependent
+	 * effect through UAuraAbilitySystemComponent::RefreshLevelDependentEffects and forces a single net update carrying
+	 * the level and all recalculated attributes. OnLevelChanged is broadcast once, after the attributes are updated.
+	 *
+	 * @param InLevel The new level of the player.
+	 */
+	void SetLevel(int32 InLevel);
+
+	/**
+	 * @brief Broadcast once per level change, on the server from SetLevel and on clients from OnRep_Level.
+	 */
+	FOnPlayerLevelChanged OnLevelChanged;
+
+	/**
+	 * @brief Raises the net update frequency to ActiveNetUpdateFrequency and forces a net update.
+	 *
+	 * Bound to UAuraAbilitySystemComponent::OnReplicatedActivity, so any attribute, tag, effect or ability change
+	 * replicates right away. Once the player state stayed idle for ActiveNetUpdateHoldTime, the frequency halves every
+	 * NetUpdateFrequencyDecayInterval until it reaches IdleNetUpdateFrequency. Does nothing on clients.
+	 */
+	void RaiseNetUpdateFrequency();
+
 protected:
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/**
 	 * A reference to the Ability System Component associated with this PlayerState.
 	 * This component is responsible for managing gameplay abilities and attributes.
@@ -82,13 +113,54 @@ protected:
 	UPROPERTY()
 	TObjectPtr<class UAttributeSet> AttributeSet = nullptr;
 
+	/**
+	 * Net update frequency while attributes, tags, effects or abilities of the player are changing.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Replication")
+	float ActiveNetUpdateFrequency = 100.f;
+
+	/**
+	 * Net update frequency the player state decays to while idle.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Replication")
+	float IdleNetUpdateFrequency = 2.f;
+
+	/**
+	 * Time in seconds without replicated activity before the net update frequency starts to decay.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Replication")
+	float ActiveNetUpdateHoldTime = 1.f;
+
+	/**
+	 * Time in seconds between two halvings of the net update frequency while decaying.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Replication")
+	float NetUpdateFrequencyDecayInterval = 0.5f;
+
 private:
+	/**
+	 * Halves the net update frequency if the player state stayed idle for ActiveNetUpdateHoldTime, and stops decaying
+	 * once IdleNetUpdateFrequency is reached.
+	 */
+	void DecayNetUpdateFrequency();
+
+	/**
+	 * Fires DecayNetUpdateFrequency while the frequency is above IdleNetUpdateFrequency.
+	 */
+	FTimerHandle NetUpdateFrequencyDecayTimerHandle;
+
+	/**
+	 * World time of the last replicated activity.
+	 */
+	double LastReplicatedActivityTime = 0.0;
+
 	/**
 	 * Represents the player's current level.
 	 *
 	 * This variable is replicated across the network to ensure consistency
 	 * in multiplayer scenarios and has its value updated on all clients
-	 * when a change is detected. The `OnRep_Level` function is called
+	 * when a change is detected. Replication is push based, so it must only
+	 * be changed through SetLevel. The `OnRep_Level` function is called
 	 * whenever replication occurs to handle any custom behavior or logic
 	 * triggered by the level change.
 	 *
@@ -3,3 +3,28 @@
 
 #include "Game/Input/AuraInputComponent.h"
 
+bool UAuraInputComponent::UnbindAbilityAction(const UInputAction* InputAction)
+{
+	FAbilityActionBinding Binding;
+	if (!AbilityActionBindings.RemoveAndCopyValue(InputAction, Binding))
+	{
+		return false;
+	}
+
+	for (const uint32 BindingHandle : Binding.BindingHandles)
+	{
+		RemoveBindingByHandle(BindingHandle);
+	}
+
+	return true;
+}
+
+FGameplayTag UAuraInputComponent::GetBoundAbilityInputTag(const UInputAction* InputAction) const
+{
+	if (const FAbilityActionBinding* Binding = AbilityActionBindings.Find(InputAction))
+	{
+		return Binding->InputTag;
+	}
+
+	return FGameplayTag();
+}
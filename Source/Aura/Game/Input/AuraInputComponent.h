@@ -29,6 +29,53 @@ public:
 	template<class UserClass, typename PressedFuncType, typename ReleasedFuncType, typename HeldFuncType>
 	void BindAbilityActions(const UAuraInputConfig* InputConfig, UserClass* Object, PressedFuncType PressedFunc,
 	                        ReleasedFuncType ReleasedFunc, HeldFuncType HeldFunc);
+
+	/**
+	 * Binds a single ability input action to the respective functions for press, release, and hold actions.
+	 *
+	 * Any previous ability binding of the same input action is removed first, so this can be used to remap an
+	 * input action to another input tag at runtime without touching the other bindings.
+	 *
+	 * @param Action The input action and the input tag passed to the bound functions.
+	 * @param Object The object instance on which the pressed, released, and held functions will be called.
+	 * @param PressedFunc The function to call when the input action is pressed. Can be null.
+	 * @param ReleasedFunc The function to call when the input action is released. Can be null.
+	 * @param HeldFunc The function to call when the input action is held. Can be null.
+	 */
+	template<class UserClass, typename PressedFuncType, typename ReleasedFuncType, typename HeldFuncType>
+	void BindAbilityAction(const FAuraInputAction& Action, UserClass* Object, PressedFuncType PressedFunc,
+	                       ReleasedFuncType ReleasedFunc, HeldFuncType HeldFunc);
+
+	/**
+	 * Removes the press, release, and hold bindings previously made for an ability input action.
+	 *
+	 * @param InputAction The input action to unbind.
+	 * @return True if the input action had ability bindings.
+	 */
+	bool UnbindAbilityAction(const UInputAction* InputAction);
+
+	/**
+	 * Returns the input tag an ability input action is currently bound with, or an empty tag if it is not bound.
+	 *
+	 * @param InputAction The input action to look up.
+	 */
+	FGameplayTag GetBoundAbilityInputTag(const UInputAction* InputAction) const;
+
+private:
+	/**
+	 * @brief The bindings made for one ability input action.
+	 */
+	struct FAbilityActionBinding
+	{
+		FGameplayTag InputTag;
+
+		TArray<uint32, TInlineAllocator<3>> BindingHandles;
+	};
+
+	/**
+	 * Ability bindings keyed by input action, so a single action can be rebound without rebuilding the others.
+	 */
+	TMap<const UInputAction*, FAbilityActionBinding> AbilityActionBindings;
 };
 
 /**
@@ -58,22 +105,36 @@ void UAuraInputComponent::BindAbilityActions(const UAuraInputConfig* InputConfig
 
 	for (const FAuraInputAction& Action : InputConfig->AbilityInputActions)
 	{
-		if (Action.InputAction && Action.InputTag.IsValid())
-		{
-			if (PressedFunc)
-			{
-				BindAction(Action.InputAction, ETriggerEvent::Started, Object, PressedFunc, Action.InputTag);
-			}
-
-			if (ReleasedFunc)
-			{
-				BindAction(Action.InputAction, ETriggerEvent::Completed, Object, ReleasedFunc, Action.InputTag);
-			}
-
-			if (HeldFunc)
-			{
-				BindAction(Action.InputAction, ETriggerEvent::Triggered, Object, HeldFunc, Action.InputTag);
-			}
-		}
+		BindAbilityAction(Action, Object, PressedFunc, ReleasedFunc, HeldFunc);
+	}
+}
+
+template <class UserClass, typename PressedFuncType, typename ReleasedFuncType, typename HeldFuncType>
+void UAuraInputComponent::BindAbilityAction(const FAuraInputAction& Action, UserClass* Object,
+                                            PressedFuncType PressedFunc, ReleasedFuncType ReleasedFunc, HeldFuncType HeldFunc)
+{
+	if (!Action.InputAction || !Action.InputTag.IsValid())
+	{
+		return;
+	}
+
+	UnbindAbilityAction(Action.InputAction);
+
+	FAbilityActionBinding& Binding = AbilityActionBindings.Add(Action.InputAction);
+	Binding.InputTag = Action.InputTag;
+
+	if (PressedFunc)
+	{
+		Binding.BindingHandles.Add(BindAction(Action.InputAction, ETriggerEvent::Started, Object, PressedFunc, Action.InputTag).GetHandle());
+	}
+
+	if (ReleasedFunc)
+	{
+		Binding.BindingHandles.Add(BindAction(Action.InputAction, ETriggerEvent::Completed, Object, ReleasedFunc, Action.InputTag).GetHandle());
+	}
+
+	if (HeldFunc)
+	{
+		Binding.BindingHandles.Add(BindAction(Action.InputAction, ETriggerEvent::Triggered, Object, HeldFunc, Action.InputTag).GetHandle());
 	}
 }
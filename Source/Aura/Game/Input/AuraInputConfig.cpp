@@ -6,12 +6,9 @@
 const UInputAction* UAuraInputConfig::FindAbilityInputActionForTag(const FGameplayTag& InputTag,
 	bool bLogNotFound) const
 {
-	for (const FAuraInputAction& Action : AbilityInputActions)
+	if (const UInputAction* const* L_InputAction = InputActionsByTag.Find(InputTag))
 	{
-		if (Action.InputAction && Action.InputTag == InputTag)
-		{
-			return Action.InputAction;
-		}
+		return *L_InputAction;
 	}
 
 	if (bLogNotFound)
@@ -21,3 +18,56 @@ const UInputAction* UAuraInputConfig::FindAbilityInputActionForTag(const FGamepl
 
 	return nullptr;
 }
+
+FGameplayTag UAuraInputConfig::FindAbilityInputTagForAction(const UInputAction* InputAction, bool bLogNotFound) const
+{
+	if (const FGameplayTag* L_InputTag = InputTagsByAction.Find(InputAction))
+	{
+		return *L_InputTag;
+	}
+
+	if (bLogNotFound)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Cant find InputTag for AbilityAction [%s], on InputConfig [%s]"), *GetNameSafe(InputAction), *GetNameSafe(this));
+	}
+
+	return FGameplayTag();
+}
+
+void UAuraInputConfig::RebuildInputIndex()
+{
+	InputActionsByTag.Reset();
+	InputTagsByAction.Reset();
+
+	for (const FAuraInputAction& Action : AbilityInputActions)
+	{
+		if (Action.InputAction && Action.InputTag.IsValid())
+		{
+			if (!InputActionsByTag.Contains(Action.InputTag))
+			{
+				InputActionsByTag.Add(Action.InputTag, Action.InputAction);
+			}
+
+			if (!InputTagsByAction.Contains(Action.InputAction))
+			{
+				InputTagsByAction.Add(Action.InputAction, Action.InputTag);
+			}
+		}
+	}
+}
+
+void UAuraInputConfig::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildInputIndex();
+}
+
+#if WITH_EDITOR
+void UAuraInputConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildInputIndex();
+}
+#endif
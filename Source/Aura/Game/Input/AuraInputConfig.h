@@ -39,7 +39,8 @@ struct FAuraInputAction
  * It is primarily used for input handling, ability triggering, and dynamic configuration of input behaviors.
  *
  * Public Methods:
- * - FindAbilityInputActionForTag: Searches for the input action associated with a specific gameplay tag.
+ * - FindAbilityInputActionForTag: Looks up the input action associated with a specific gameplay tag.
+ * - FindAbilityInputTagForAction: Looks up the gameplay tag associated with a specific input action.
  *
  * Properties:
  * - AbilityInputActions: An array of input actions and their gameplay tag mappings for ability input configuration.
@@ -53,7 +54,7 @@ public:
 	/**
 	 * Finds and retrieves the input action associated with a specific gameplay tag.
 	 *
-	 * This method iterates through a collection of input actions and their corresponding gameplay tags to find a match for the given tag.
+	 * This method looks the tag up in the index built from AbilityInputActions, so it runs in constant time.
 	 * If a matching input action is not found and logging is enabled, an error message is logged.
 	 *
 	 * @param InputTag The gameplay tag used to search for the associated input action.
@@ -62,6 +63,31 @@ public:
 	 */
 	const UInputAction* FindAbilityInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound = false) const;
 
+	/**
+	 * Finds and retrieves the gameplay tag associated with a specific input action.
+	 *
+	 * The reverse lookup of FindAbilityInputActionForTag, used e.g. by key hint widgets that start from an input action.
+	 *
+	 * @param InputAction The input action used to search for the associated gameplay tag.
+	 * @param bLogNotFound A boolean flag indicating whether an error message should be logged if no matching tag is found.
+	 * @return The gameplay tag associated with the given input action. Returns an empty tag if no match is found.
+	 */
+	FGameplayTag FindAbilityInputTagForAction(const UInputAction* InputAction, bool bLogNotFound = false) const;
+
+	/**
+	 * Rebuilds the tag-to-action and action-to-tag indices from AbilityInputActions.
+	 *
+	 * Called automatically after loading and after editing the asset. Must be called manually if AbilityInputActions
+	 * is modified at runtime. When a tag or action appears more than once, the first entry wins.
+	 */
+	void RebuildInputIndex();
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 	/**
 	 * An array that holds mappings between input actions and gameplay tags for defining ability input configurations.
 	 *
@@ -71,4 +97,15 @@ public:
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
 	TArray<FAuraInputAction> AbilityInputActions;
+
+private:
+	/**
+	 * Input action of every valid entry of AbilityInputActions, keyed by its tag.
+	 */
+	TMap<FGameplayTag, const UInputAction*> InputActionsByTag;
+
+	/**
+	 * Tag of every valid entry of AbilityInputActions, keyed by its input action.
+	 */
+	TMap<const UInputAction*, FGameplayTag> InputTagsByAction;
 };
@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Networking/AuraNetRelevancySubsystem.h"
+
+#include "Camera/CameraComponent.h"
+#include "GameFramework/PlayerController.h"
+
+bool UAuraNetRelevancySubsystem::IsRelevantForViewer(const AActor* RealViewer, const FVector& Location, bool& bOutRelevant) const
+{
+	const FIntRect* ViewCells = ViewCellsByViewer.Find(RealViewer);
+	if (ViewCells == nullptr)
+	{
+		return false;
+	}
+
+	const FIntPoint L_Cell = GetCell(Location);
+	bOutRelevant = L_Cell.X >= ViewCells->Min.X && L_Cell.X <= ViewCells->Max.X && L_Cell.Y >= ViewCells->Min.Y && L_Cell.Y <= ViewCells->Max.Y;
+	return true;
+}
+
+void UAuraNetRelevancySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ViewCellsByViewer.Reset();
+
+	if (GetWorld()->GetNetMode() == NM_Client || GetWorld()->GetNetMode() == NM_Standalone)
+	{
+		return;
+	}
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		const APawn* Pawn = IsValid(PC) ? PC->GetPawn() : nullptr;
+		const UCameraComponent* Camera = IsValid(Pawn) ? Pawn->FindComponentByClass<UCameraComponent>() : nullptr;
+		if (!IsValid(Camera))
+		{
+			continue;
+		}
+
+		FBox2D L_ViewRect = ComputeGroundViewRect(Camera->GetComponentLocation(), Camera->GetComponentRotation(), Camera->FieldOfView, Pawn->GetActorLocation().Z);
+		L_ViewRect = L_ViewRect.ExpandBy(ViewMargin);
+
+		ViewCellsByViewer.Add(PC, FIntRect(GetCell(FVector(L_ViewRect.Min, 0.f)), GetCell(FVector(L_ViewRect.Max, 0.f))));
+	}
+}
+
+TStatId UAuraNetRelevancySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraNetRelevancySubsystem, STATGROUP_Tickables);
+}
+
+bool UAuraNetRelevancySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FBox2D UAuraNetRelevancySubsystem::ComputeGroundViewRect(const FVector& CameraLocation, const FRotator& CameraRotation, float FieldOfView, float GroundHeight) const
+{
+	const float L_HalfWidth = FMath::Tan(FMath::DegreesToRadians(FieldOfView * 0.5f));
+	const float L_HalfHeight = L_HalfWidth / FMath::Max(ViewAspectRatio, KINDA_SMALL_NUMBER);
+
+	const FRotationMatrix L_CameraAxes(CameraRotation);
+	const FVector L_Forward = L_CameraAxes.GetUnitAxis(EAxis::X);
+	const FVector L_Right = L_CameraAxes.GetUnitAxis(EAxis::Y);
+	const FVector L_Up = L_CameraAxes.GetUnitAxis(EAxis::Z);
+
+	FBox2D R_ViewRect(ForceInit);
+	R_ViewRect += FVector2D(CameraLocation);
+
+	for (const float Horizontal : { -L_HalfWidth, L_HalfWidth })
+	{
+		for (const float Vertical : { -L_HalfHeight, L_HalfHeight })
+		{
+			const FVector L_Ray = (L_Forward + L_Right * Horizontal + L_Up * Vertical).GetSafeNormal();
+
+			// Rays pointing at or above the horizon are cut off at the maximum view distance.
+			float L_GroundDistance = MaxViewDistance;
+			if (L_Ray.Z < -KINDA_SMALL_NUMBER)
+			{
+				const float L_RayLength = (GroundHeight - CameraLocation.Z) / L_Ray.Z;
+				L_GroundDistance = FMath::Clamp(L_RayLength * static_cast<float>(FVector2D(L_Ray).Size()), 0.f, MaxViewDistance);
+			}
+
+			R_ViewRect += FVector2D(CameraLocation) + FVector2D(L_Ray).GetSafeNormal() * L_GroundDistance;
+		}
+	}
+
+	return R_ViewRect;
+}
+
+FIntPoint UAuraNetRelevancySubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / GridCellSize), FMath::FloorToInt32(Location.Y / GridCellSize));
+}
@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraNetRelevancySubsystem.generated.h"
+
+/**
+ * @class UAuraNetRelevancySubsystem
+ * @brief Decides the net relevancy of enemies and projectiles from what each player's top-down camera can see.
+ *
+ * Every tick on the server, the view frustum of each player pawn's camera component is intersected with the ground
+ * plane at the pawn's height. The bounding rectangle of the intersection, grown by ViewMargin, is quantized to cells
+ * of GridCellSize and stored per player controller. AAuraEnemy and AAuraProjectile override IsNetRelevantFor and ask
+ * IsRelevantForViewer, which only quantizes the actor location and compares it with the cell rectangle of the viewer,
+ * so the check costs the same however many actors or players there are.
+ *
+ * The server does not know the viewport size of remote players, so the horizontal field of view is derived from the
+ * camera's and the vertical one from ViewAspectRatio.
+ */
+UCLASS(Config = Game)
+class AURA_API UAuraNetRelevancySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Tests whether a location lies inside the view of a connection.
+	 *
+	 * @param RealViewer The player controller of the connection, as passed to IsNetRelevantFor.
+	 * @param Location The location of the actor being tested.
+	 * @param bOutRelevant Set to whether the location lies in the viewer's view rectangle.
+	 * @return False if the viewer has no view rectangle, in which case the caller falls back to the default rules.
+	 */
+	bool IsRelevantForViewer(const AActor* RealViewer, const FVector& Location, bool& bOutRelevant) const;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/**
+	 * Restricts the subsystem to game and PIE worlds.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/**
+	 * Size in centimeters of the square cells view rectangles are quantized to.
+	 */
+	UPROPERTY(Config)
+	float GridCellSize = 1000.f;
+
+	/**
+	 * Distance in centimeters the view rectangle is grown by on every side, so actors replicate before they enter the screen.
+	 */
+	UPROPERTY(Config)
+	float ViewMargin = 800.f;
+
+	/**
+	 * Width divided by height of the assumed viewport.
+	 */
+	UPROPERTY(Config)
+	float ViewAspectRatio = 16.f / 9.f;
+
+	/**
+	 * Maximum ground distance of the view from the camera, used for frustum edges that do not hit the ground.
+	 */
+	UPROPERTY(Config)
+	float MaxViewDistance = 10000.f;
+
+private:
+	/**
+	 * Computes the ground view rectangle of a camera, without margin.
+	 */
+	FBox2D ComputeGroundViewRect(const FVector& CameraLocation, const FRotator& CameraRotation, float FieldOfView, float GroundHeight) const;
+
+	/**
+	 * Returns the cell containing a location.
+	 */
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/**
+	 * The cells in view of each player controller, inclusive on both ends.
+	 */
+	TMap<TObjectKey<AActor>, FIntRect> ViewCellsByViewer;
+};
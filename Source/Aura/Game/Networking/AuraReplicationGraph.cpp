@@ -0,0 +1,220 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Networking/AuraReplicationGraph.h"
+
+#include "Engine/NetDriver.h"
+#include "Game/Characters/AuraEnemy/AuraEnemy.h"
+#include "Game/Characters/PlayerState/AuraPlayerState.h"
+#include "Game/EffectActor/AuraEffectActor.h"
+#include "GameFramework/PlayerController.h"
+#include "ProjectileActor/AuraProjectile.h"
+
+void UAuraReplicationGraphNode_AlwaysRelevant_ForConnection::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	ReplicationActorList.Reset();
+
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		ReplicationActorList.ConditionalAdd(Viewer.InViewer);
+		ReplicationActorList.ConditionalAdd(Viewer.ViewTarget);
+
+		if (const APlayerController* PC = Cast<APlayerController>(Viewer.InViewer))
+		{
+			ReplicationActorList.ConditionalAdd(PC->PlayerState);
+			ReplicationActorList.ConditionalAdd(PC->GetPawn());
+		}
+	}
+
+	if (IsValid(ReplicationGraph))
+	{
+		for (const FActorRepListType& Actor : ReplicationGraph->GetOwnerOnlyActors())
+		{
+			const UNetConnection* L_OwnerConnection = Actor->GetNetConnection();
+			if (L_OwnerConnection == nullptr)
+			{
+				continue;
+			}
+
+			for (const FNetViewer& Viewer : Params.Viewers)
+			{
+				if (Viewer.Connection == L_OwnerConnection)
+				{
+					ReplicationActorList.ConditionalAdd(Actor);
+					break;
+				}
+			}
+		}
+	}
+
+	Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorList);
+}
+
+void UAuraReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	FClassReplicationInfo EnemyInfo;
+	EnemyInfo.SetCullDistanceSquared(FMath::Square(EnemyCullDistance));
+	EnemyInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(GetDefault<AAuraEnemy>()->GetNetUpdateFrequency());
+	GlobalActorReplicationInfoMap.SetClassInfo(AAuraEnemy::StaticClass(), EnemyInfo);
+
+	// Projectiles are the fast path: every frame, and favored when the connection is saturated.
+	FClassReplicationInfo ProjectileInfo;
+	ProjectileInfo.SetCullDistanceSquared(FMath::Square(ProjectileCullDistance));
+	ProjectileInfo.ReplicationPeriodFrame = 1;
+	ProjectileInfo.StarvationPriorityScale = 2.f;
+	GlobalActorReplicationInfoMap.SetClassInfo(AAuraProjectile::StaticClass(), ProjectileInfo);
+
+	FClassReplicationInfo EffectActorInfo;
+	EffectActorInfo.SetCullDistanceSquared(FMath::Square(EffectActorCullDistance));
+	EffectActorInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(GetDefault<AAuraEffectActor>()->GetNetUpdateFrequency());
+	GlobalActorReplicationInfoMap.SetClassInfo(AAuraEffectActor::StaticClass(), EffectActorInfo);
+
+	// The owner's ability system lives on the player state, so the class period is the player state's own frequency.
+	// Other players' states are throttled by PlayerStateNode instead.
+	FClassReplicationInfo PlayerStateInfo;
+	PlayerStateInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(GetDefault<AAuraPlayerState>()->GetNetUpdateFrequency());
+	GlobalActorReplicationInfoMap.SetClassInfo(AAuraPlayerState::StaticClass(), PlayerStateInfo);
+}
+
+void UAuraReplicationGraph::InitGlobalGraphNodes()
+{
+	Super::InitGlobalGraphNodes();
+
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = GridCellSize;
+	GridNode->SpatialBias = GridSpatialBias;
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	PlayerStateNode = CreateNewNode<UReplicationGraphNode_PlayerStateFrequencyLimiter>();
+	PlayerStateNode->TargetActorsPerFrame = FMath::Max(PlayerStatesPerFrame, 1);
+	AddGlobalGraphNode(PlayerStateNode);
+}
+
+void UAuraReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	UAuraReplicationGraphNode_AlwaysRelevant_ForConnection* AlwaysRelevantForConnectionNode = CreateNewNode<UAuraReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AlwaysRelevantForConnectionNode->ReplicationGraph = this;
+	AddConnectionGraphNode(AlwaysRelevantForConnectionNode, RepGraphConnection);
+}
+
+void UAuraReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	const AActor* Actor = ActorInfo.Actor;
+
+	if (Actor->IsA<AAuraEnemy>())
+	{
+		GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+	}
+	else if (Actor->IsA<AAuraProjectile>() || Actor->IsA<APawn>())
+	{
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+	}
+	else if (Actor->IsA<AAuraEffectActor>())
+	{
+		GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+	}
+	else if (Actor->IsA<AAuraPlayerState>())
+	{
+		// PlayerStateNode reads the player states from the game state every frame.
+	}
+	else if (Actor->bAlwaysRelevant)
+	{
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+	}
+	else if (!Actor->bOnlyRelevantToOwner)
+	{
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+	}
+	else
+	{
+		OwnerOnlyActors.Add(ActorInfo.Actor);
+	}
+}
+
+void UAuraReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	const AActor* Actor = ActorInfo.Actor;
+
+	if (Actor->IsA<AAuraEnemy>())
+	{
+		GridNode->RemoveActor_Dormancy(ActorInfo);
+	}
+	else if (Actor->IsA<AAuraProjectile>() || Actor->IsA<APawn>())
+	{
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+	}
+	else if (Actor->IsA<AAuraEffectActor>())
+	{
+		GridNode->RemoveActor_Static(ActorInfo);
+	}
+	else if (Actor->IsA<AAuraPlayerState>())
+	{
+		// PlayerStateNode reads the player states from the game state every frame.
+	}
+	else if (Actor->bAlwaysRelevant)
+	{
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+	}
+	else if (!Actor->bOnlyRelevantToOwner)
+	{
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+	}
+	else
+	{
+		OwnerOnlyActors.RemoveFast(ActorInfo.Actor);
+	}
+}
+
+void UAuraReplicationGraph::SetNetUpdateFrequency(AActor* Actor, float NetUpdateFrequency)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	Actor->SetNetUpdateFrequency(NetUpdateFrequency);
+
+	if (const UNetDriver* L_NetDriver = Actor->GetNetDriver(); L_NetDriver != nullptr)
+	{
+		if (UAuraReplicationGraph* L_ReplicationGraph = L_NetDriver->GetReplicationDriver<UAuraReplicationGraph>())
+		{
+			L_ReplicationGraph->ApplyNetUpdateFrequency(Actor, NetUpdateFrequency);
+		}
+	}
+}
+
+void UAuraReplicationGraph::ApplyNetUpdateFrequency(AActor* Actor, float NetUpdateFrequency)
+{
+	const uint16 L_PeriodFrame = GetReplicationPeriodFrameForFrequency(NetUpdateFrequency);
+
+	// Not routed yet, the actor picks the new frequency up from its class settings and NetUpdateFrequency.
+	FGlobalActorReplicationInfo* L_GlobalInfo = GlobalActorReplicationInfoMap.Find(Actor);
+	if (L_GlobalInfo == nullptr)
+	{
+		return;
+	}
+	L_GlobalInfo->Settings.ReplicationPeriodFrame = L_PeriodFrame;
+
+	// Each connection copied the period when it first saw the actor.
+	for (UNetReplicationGraphConnection* Connection : Connections)
+	{
+		if (FConnectionReplicationActorInfo* L_ConnectionInfo = Connection->ActorInfoMap.Find(Actor))
+		{
+			L_ConnectionInfo->ReplicationPeriodFrame = L_PeriodFrame;
+		}
+	}
+}
+
+uint16 UAuraReplicationGraph::GetReplicationPeriodFrameForFrequency(float NetUpdateFrequency) const
+{
+	const float L_ServerTickRate = NetDriver != nullptr ? NetDriver->GetNetServerMaxTickRate() : 30.f;
+	const int32 L_PeriodFrame = FMath::RoundToInt(L_ServerTickRate / FMath::Max(NetUpdateFrequency, KINDA_SMALL_NUMBER));
+	return static_cast<uint16>(FMath::Clamp(L_PeriodFrame, 1, static_cast<int32>(MAX_uint16)));
+}
@@ -0,0 +1,174 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "AuraReplicationGraph.generated.h"
+
+class UAuraReplicationGraph;
+
+/**
+ * @class UAuraReplicationGraphNode_AlwaysRelevant_ForConnection
+ * @brief Replicates the player controller, player state and pawn of a connection to that connection every frame.
+ *
+ * These actors are gathered straight from the connection's viewers, so they never go through the spatial grid for
+ * their own connection, whatever their location. The node also gathers the owner only actors of the graph that are
+ * owned by one of the connection's viewers. Their owner can change at any time, so it is checked on every gather,
+ * which costs one pointer comparison per owner only actor and viewer.
+ */
+UCLASS()
+class AURA_API UAuraReplicationGraphNode_AlwaysRelevant_ForConnection : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override {}
+
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override { return false; }
+
+	virtual void NotifyResetAllNetworkActors() override {}
+
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	/**
+	 * The graph whose owner only actors are gathered, set when the node is created.
+	 */
+	UPROPERTY()
+	TObjectPtr<const UAuraReplicationGraph> ReplicationGraph = nullptr;
+
+private:
+	/**
+	 * The actors gathered for the connection in the current frame.
+	 */
+	FActorRepListRefView ReplicationActorList;
+};
+
+/**
+ * @class UAuraReplicationGraph
+ * @brief Replication graph of the Aura game, keeping per connection gather cost independent of the total actor count.
+ *
+ * Actors are routed by class:
+ * - AAuraEffectActor goes into the spatial grid as a static actor, it never moves;
+ * - AAuraEnemy goes into the grid as a dormancy aware actor, so dormant enemies are not gathered at all;
+ * - AAuraProjectile goes into the grid as a dynamic actor and replicates every frame with a high starvation priority,
+ *   since it is short lived and moves fast;
+ * - other pawns, like the player characters, go into the grid as dynamic actors for other connections;
+ * - AAuraPlayerState replicates at its own net update frequency. Other connections only gather PlayerStatesPerFrame
+ *   player states per frame through a UReplicationGraphNode_PlayerStateFrequencyLimiter, on top of the ones that
+ *   called ForceNetUpdate;
+ * - every connection additionally gathers its own controller, player state and pawn every frame through
+ *   UAuraReplicationGraphNode_AlwaysRelevant_ForConnection, so the owner's ability system is only limited by the
+ *   frequency of its player state;
+ * - always relevant actors like the game state go into a global list;
+ * - other owner only actors go into OwnerOnlyActors, which each connection node filters for the actors its viewers own.
+ *
+ * A connection only gathers the grid cells around its view target, so its cost grows with the actors near the player.
+ * Settings are read from the [/Script/Aura.AuraReplicationGraph] section of the Engine config.
+ *
+ * The graph copies the class settings of an actor when it is added, so a later AActor::SetNetUpdateFrequency does not
+ * reach it. Actors whose frequency changes at runtime go through SetNetUpdateFrequency instead.
+ */
+UCLASS(Transient, Config = Engine)
+class AURA_API UAuraReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	virtual void InitGlobalActorClassSettings() override;
+
+	virtual void InitGlobalGraphNodes() override;
+
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	/**
+	 * Returns the actors only relevant to their owner that are not routed to any other node.
+	 */
+	const FActorRepListRefView& GetOwnerOnlyActors() const { return OwnerOnlyActors; }
+
+	/**
+	 * @brief Sets the net update frequency of an actor and its replication period in the graph of its net driver.
+	 *
+	 * Works without a replication graph as well, then it only sets the frequency of the actor. Only call with
+	 * authority.
+	 *
+	 * @param Actor The replicated actor.
+	 * @param NetUpdateFrequency The new net update frequency of the actor.
+	 */
+	static void SetNetUpdateFrequency(AActor* Actor, float NetUpdateFrequency);
+
+protected:
+	/**
+	 * Size in centimeters of the cells of the spatial grid.
+	 */
+	UPROPERTY(Config)
+	float GridCellSize = 10000.f;
+
+	/**
+	 * Offset of the grid origin, should be below the lowest X and Y coordinates of the largest map.
+	 */
+	UPROPERTY(Config)
+	FVector2D GridSpatialBias = FVector2D(-200000.f, -200000.f);
+
+	/**
+	 * Distance in centimeters beyond which enemies are not replicated to a connection.
+	 */
+	UPROPERTY(Config)
+	float EnemyCullDistance = 8000.f;
+
+	/**
+	 * Distance in centimeters beyond which projectiles are not replicated to a connection.
+	 */
+	UPROPERTY(Config)
+	float ProjectileCullDistance = 6000.f;
+
+	/**
+	 * Distance in centimeters beyond which effect actors are not replicated to a connection.
+	 */
+	UPROPERTY(Config)
+	float EffectActorCullDistance = 6000.f;
+
+	/**
+	 * How many player states of other players each connection gathers per frame.
+	 */
+	UPROPERTY(Config)
+	int32 PlayerStatesPerFrame = 2;
+
+private:
+	/**
+	 * Returns the number of replication frames between two updates of an actor with the given frequency.
+	 */
+	uint16 GetReplicationPeriodFrameForFrequency(float NetUpdateFrequency) const;
+
+	/**
+	 * Updates the replication period of a routed actor, globally and for every connection that already knows it.
+	 */
+	void ApplyNetUpdateFrequency(AActor* Actor, float NetUpdateFrequency);
+
+	/**
+	 * The spatial grid holding enemies, projectiles, effect actors and pawns.
+	 */
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode = nullptr;
+
+	/**
+	 * Always relevant actors, gathered for every connection.
+	 */
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode = nullptr;
+
+	/**
+	 * The player states of all players, gathered PlayerStatesPerFrame at a time for every connection.
+	 */
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_PlayerStateFrequencyLimiter> PlayerStateNode = nullptr;
+
+	/**
+	 * Actors only relevant to their owner, gathered per connection by UAuraReplicationGraphNode_AlwaysRelevant_ForConnection.
+	 */
+	FActorRepListRefView OwnerOnlyActors;
+};
@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Profiling/AuraCharacterMemoryReport.h"
+
+#include "Camera/CameraComponent.h"
+#include "EngineUtils.h"
+#include "Game/Characters/CharacterBase/AuraCharacterBase.h"
+#include "GameFramework/SpringArmComponent.h"
+#include "HAL/IConsoleManager.h"
+
+namespace AuraCharacterMemoryReport
+{
+	/**
+	 * Returns the object size and exclusive resource size of an object.
+	 */
+	SIZE_T GetObjectBytes(const UObject* Object)
+	{
+		return Object->GetClass()->GetStructureSize() + Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CharacterMemoryReportCommand(
+		TEXT("Aura.CharacterMemoryReport"),
+		TEXT("Lists the memory taken per instance by each character class of the world."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>&, UWorld* World, FOutputDevice& Ar)
+		{
+			FAuraCharacterMemoryReport::Print(World, Ar);
+		}));
+}
+
+void FAuraCharacterMemoryReport::Print(const UWorld* World, FOutputDevice& Ar)
+{
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	struct FClassStats
+	{
+		int32 Instances = 0;
+		SIZE_T TotalBytes = 0;
+		bool bHasCameraRig = false;
+	};
+
+	TMap<const UClass*, FClassStats> L_StatsByClass;
+	for (TActorIterator<AAuraCharacterBase> It(World); It; ++It)
+	{
+		const AAuraCharacterBase* Character = *It;
+		FClassStats& Stats = L_StatsByClass.FindOrAdd(Character->GetClass());
+		++Stats.Instances;
+		Stats.bHasCameraRig = Character->FindComponentByClass<UCameraComponent>() != nullptr;
+
+		Stats.TotalBytes += AuraCharacterMemoryReport::GetObjectBytes(Character);
+
+		TArray<UObject*> L_Subobjects;
+		GetObjectsWithOuter(Character, L_Subobjects, true);
+		for (const UObject* Subobject : L_Subobjects)
+		{
+			Stats.TotalBytes += AuraCharacterMemoryReport::GetObjectBytes(Subobject);
+		}
+	}
+
+	const SIZE_T L_CameraRigBytes = USpringArmComponent::StaticClass()->GetStructureSize() + UCameraComponent::StaticClass()->GetStructureSize();
+
+	Ar.Logf(TEXT("Character memory report, camera rig: %llu bytes"), static_cast<uint64>(L_CameraRigBytes));
+	Ar.Logf(TEXT("%-40s %10s %16s %12s %20s"), TEXT("Class"), TEXT("Instances"), TEXT("Bytes/Instance"), TEXT("Camera Rig"), TEXT("Bytes/Instance w/ Rig"));
+	for (const TPair<const UClass*, FClassStats>& Pair : L_StatsByClass)
+	{
+		const FClassStats& Stats = Pair.Value;
+		const uint64 L_BytesPerInstance = Stats.TotalBytes / FMath::Max(Stats.Instances, 1);
+		const uint64 L_BytesWithRig = Stats.bHasCameraRig ? L_BytesPerInstance : L_BytesPerInstance + L_CameraRigBytes;
+
+		Ar.Logf(TEXT("%-40s %10d %16llu %12s %20llu"), *Pair.Key->GetName(), Stats.Instances, L_BytesPerInstance,
+			Stats.bHasCameraRig ? TEXT("yes") : TEXT("no"), L_BytesWithRig);
+	}
+}
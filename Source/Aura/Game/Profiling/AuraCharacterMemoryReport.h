@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+
+/**
+ * @class FAuraCharacterMemoryReport
+ * @brief Reports how much memory the characters of a world take per class.
+ *
+ * For every character class with live instances, the report lists the instance count, the average bytes per instance
+ * and whether the class creates the camera rig. Bytes per instance add up the object size and exclusive resource size
+ * of the actor and of every object it outers, components and attribute sets included. Classes that skip the camera
+ * rig also list what an instance would take with it, which gives the before and after of the optional subobjects.
+ *
+ * Run with the console command Aura.CharacterMemoryReport.
+ */
+class AURA_API FAuraCharacterMemoryReport
+{
+public:
+	/**
+	 * @brief Writes the report for all characters of a world.
+	 *
+	 * @param World The world whose characters are measured.
+	 * @param Ar The output device the report is written to.
+	 */
+	static void Print(const UWorld* World, FOutputDevice& Ar);
+};
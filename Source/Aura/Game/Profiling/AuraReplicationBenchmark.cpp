@@ -0,0 +1,261 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Profiling/AuraReplicationBenchmark.h"
+
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "Game/Characters/AuraEnemy/AuraEnemy.h"
+#include "Game/Spawning/AuraEnemyPoolSubsystem.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "TimerManager.h"
+
+namespace AuraReplicationBenchmark
+{
+	/**
+	 * The push model values of the passes, in order.
+	 */
+	constexpr int32 PassPushModelValues[] = { 0, 1 };
+
+	/**
+	 * Distance in centimeters between two spawned enemies.
+	 */
+	constexpr float EnemySpacing = 200.f;
+
+	/**
+	 * Returns the console variable toggled between the passes.
+	 */
+	IConsoleVariable* FindPushModelVariable()
+	{
+		return IConsoleManager::Get().FindConsoleVariable(TEXT("net.IsPushModelEnabled"));
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice ReplicationBenchmarkCommand(
+		TEXT("Aura.ReplicationBenchmark"),
+		TEXT("Spawns enemies and measures the replication time with push model off and on. Arguments: EnemyClassPath [Enemies=500] [PassSeconds=10]."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			if (World == nullptr || Args.IsEmpty())
+			{
+				Ar.Log(TEXT("Usage: Aura.ReplicationBenchmark EnemyClassPath [Enemies=500] [PassSeconds=10]"));
+				return;
+			}
+
+			const TSubclassOf<AAuraEnemy> L_EnemyClass = LoadClass<AAuraEnemy>(nullptr, *Args[0]);
+			if (!L_EnemyClass)
+			{
+				Ar.Logf(TEXT("Replication benchmark: %s is not an enemy class"), *Args[0]);
+				return;
+			}
+
+			const int32 L_NumEnemies = Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 500;
+			const float L_PassSeconds = Args.IsValidIndex(2) ? FCString::Atof(*Args[2]) : 10.f;
+
+			if (UAuraReplicationBenchmarkSubsystem* Benchmark = World->GetSubsystem<UAuraReplicationBenchmarkSubsystem>())
+			{
+				Benchmark->StartBenchmark(L_EnemyClass, FMath::Max(L_NumEnemies, 0), FMath::Max(L_PassSeconds, 1.f), Ar);
+			}
+		}));
+}
+
+void UAuraReplicationBenchmarkSubsystem::StartBenchmark(TSubclassOf<AAuraEnemy> EnemyClass, int32 NumEnemies, float PassSeconds, FOutputDevice& Ar)
+{
+	UWorld* L_World = GetWorld();
+	if (bRunning || L_World->GetNetMode() == NM_Client || L_World->GetNetMode() == NM_Standalone)
+	{
+		Ar.Log(TEXT("Replication benchmark: needs a server world without a running benchmark"));
+		return;
+	}
+
+	IConsoleVariable* L_PushModelVariable = AuraReplicationBenchmark::FindPushModelVariable();
+	if (L_PushModelVariable == nullptr)
+	{
+		Ar.Log(TEXT("Replication benchmark: net.IsPushModelEnabled does not exist in this build"));
+		return;
+	}
+
+	UAuraEnemyPoolSubsystem* L_EnemyPool = L_World->GetSubsystem<UAuraEnemyPoolSubsystem>();
+	if (!IsValid(L_EnemyPool))
+	{
+		return;
+	}
+
+	bRunning = true;
+	CurrentPassIndex = INDEX_NONE;
+	CurrentPassSeconds = PassSeconds;
+	PreviousPushModelEnabled = L_PushModelVariable->GetInt();
+	PassResults.Reset();
+
+	FVector L_Origin = FVector::ZeroVector;
+	if (const APlayerController* L_PlayerController = L_World->GetFirstPlayerController(); IsValid(L_PlayerController) && L_PlayerController->GetPawn() != nullptr)
+	{
+		L_Origin = L_PlayerController->GetPawn()->GetActorLocation();
+	}
+
+	// A square grid centered on the origin.
+	const int32 L_Columns = FMath::Max(FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(NumEnemies))), 1);
+	const FVector L_GridOffset(-0.5f * L_Columns * AuraReplicationBenchmark::EnemySpacing, -0.5f * L_Columns * AuraReplicationBenchmark::EnemySpacing, 0.f);
+
+	BenchmarkEnemies.Reserve(NumEnemies);
+	for (int32 Index = 0; Index < NumEnemies; ++Index)
+	{
+		const FVector L_Location = L_Origin + L_GridOffset + FVector(Index % L_Columns, Index / L_Columns, 0.f) * AuraReplicationBenchmark::EnemySpacing;
+		if (AAuraEnemy* Enemy = L_EnemyPool->AcquireEnemy(EnemyClass, FTransform(L_Location)))
+		{
+			BenchmarkEnemies.Add(Enemy);
+		}
+	}
+
+	const UNetDriver* L_NetDriver = L_World->GetNetDriver();
+	Ar.Logf(TEXT("Replication benchmark: %d enemies, %d connections, %.0f s warmup, %.0f s per pass"), BenchmarkEnemies.Num(),
+		L_NetDriver != nullptr ? L_NetDriver->ClientConnections.Num() : 0, WarmupSeconds, PassSeconds);
+
+	L_World->GetTimerManager().SetTimer(PassTimerHandle, FTimerDelegate::CreateUObject(this, &UAuraReplicationBenchmarkSubsystem::BeginPass, 0),
+		WarmupSeconds, false);
+}
+
+bool UAuraReplicationBenchmarkSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAuraReplicationBenchmarkSubsystem::Deinitialize()
+{
+	if (bRunning)
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+		GetWorld()->OnPostTickFlush().Remove(PostTickFlushHandle);
+		if (IConsoleVariable* L_PushModelVariable = AuraReplicationBenchmark::FindPushModelVariable())
+		{
+			L_PushModelVariable->Set(PreviousPushModelEnabled, ECVF_SetByConsole);
+		}
+		bRunning = false;
+	}
+
+	Super::Deinitialize();
+}
+
+void UAuraReplicationBenchmarkSubsystem::BeginPass(int32 PassIndex)
+{
+	UWorld* L_World = GetWorld();
+	CurrentPassIndex = PassIndex;
+
+	FPassResult& Result = PassResults.AddDefaulted_GetRef();
+	Result.PushModelEnabled = AuraReplicationBenchmark::PassPushModelValues[PassIndex];
+
+	if (IConsoleVariable* L_PushModelVariable = AuraReplicationBenchmark::FindPushModelVariable())
+	{
+		L_PushModelVariable->Set(Result.PushModelEnabled, ECVF_SetByConsole);
+	}
+
+	// The detailed per stat timings of the net driver end up in the capture, next to the total measured here.
+	GEngine->Exec(L_World, TEXT("CsvProfile Start"));
+
+	ActorTickEndTime = 0.0;
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UAuraReplicationBenchmarkSubsystem::OnWorldPostActorTick);
+	PostTickFlushHandle = L_World->OnPostTickFlush().AddUObject(this, &UAuraReplicationBenchmarkSubsystem::OnPostTickFlush);
+
+	L_World->GetTimerManager().SetTimer(PassTimerHandle, this, &UAuraReplicationBenchmarkSubsystem::EndPass, CurrentPassSeconds, false);
+}
+
+void UAuraReplicationBenchmarkSubsystem::EndPass()
+{
+	UWorld* L_World = GetWorld();
+
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	L_World->OnPostTickFlush().Remove(PostTickFlushHandle);
+
+	GEngine->Exec(L_World, TEXT("CsvProfile Stop"));
+
+	const FPassResult& Result = PassResults.Last();
+	UE_LOG(LogTemp, Log, TEXT("Replication benchmark: push model %d, %d frames, %.3f ms average, %.3f ms max"), Result.PushModelEnabled,
+		Result.Frames, 1000.0 * Result.TotalSeconds / FMath::Max(Result.Frames, 1), 1000.0 * Result.MaxSeconds);
+
+	const int32 L_NextPassIndex = CurrentPassIndex + 1;
+	CurrentPassIndex = INDEX_NONE;
+
+	if (L_NextPassIndex < static_cast<int32>(UE_ARRAY_COUNT(AuraReplicationBenchmark::PassPushModelValues)))
+	{
+		BeginPass(L_NextPassIndex);
+	}
+	else
+	{
+		FinishBenchmark();
+	}
+}
+
+void UAuraReplicationBenchmarkSubsystem::FinishBenchmark()
+{
+	WriteCsv();
+
+	if (IConsoleVariable* L_PushModelVariable = AuraReplicationBenchmark::FindPushModelVariable())
+	{
+		L_PushModelVariable->Set(PreviousPushModelEnabled, ECVF_SetByConsole);
+	}
+
+	if (UAuraEnemyPoolSubsystem* L_EnemyPool = GetWorld()->GetSubsystem<UAuraEnemyPoolSubsystem>())
+	{
+		for (AAuraEnemy* Enemy : BenchmarkEnemies)
+		{
+			L_EnemyPool->ReleaseEnemy(Enemy);
+		}
+	}
+	BenchmarkEnemies.Reset();
+
+	bRunning = false;
+}
+
+void UAuraReplicationBenchmarkSubsystem::WriteCsv() const
+{
+	const UNetDriver* L_NetDriver = GetWorld()->GetNetDriver();
+	const int32 L_NumConnections = L_NetDriver != nullptr ? L_NetDriver->ClientConnections.Num() : 0;
+
+	FString L_Csv = TEXT("PushModelEnabled,Enemies,Connections,Frames,AverageReplicationMs,MaxReplicationMs\n");
+	for (const FPassResult& Result : PassResults)
+	{
+		L_Csv += FString::Printf(TEXT("%d,%d,%d,%d,%.4f,%.4f\n"), Result.PushModelEnabled, BenchmarkEnemies.Num(), L_NumConnections, Result.Frames,
+			1000.0 * Result.TotalSeconds / FMath::Max(Result.Frames, 1), 1000.0 * Result.MaxSeconds);
+	}
+
+	const FString L_Directory = FPaths::Combine(FPaths::ProfilingDir(), TEXT("AuraReplication"));
+	FPlatformFileManager::Get().GetPlatformFile().CreateDirectoryTree(*L_Directory);
+
+	const FString L_FilePath = FPaths::Combine(L_Directory, FString::Printf(TEXT("Replication-%s.csv"), *FDateTime::Now().ToString()));
+	if (FFileHelper::SaveStringToFile(L_Csv, *L_FilePath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("Replication benchmark written to %s"), *L_FilePath);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to write the replication benchmark to %s"), *L_FilePath);
+	}
+}
+
+void UAuraReplicationBenchmarkSubsystem::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World == GetWorld())
+	{
+		ActorTickEndTime = FPlatformTime::Seconds();
+	}
+}
+
+void UAuraReplicationBenchmarkSubsystem::OnPostTickFlush(float DeltaSeconds)
+{
+	if (ActorTickEndTime <= 0.0 || PassResults.IsEmpty())
+	{
+		return;
+	}
+
+	const double L_ReplicationSeconds = FPlatformTime::Seconds() - ActorTickEndTime;
+	ActorTickEndTime = 0.0;
+
+	FPassResult& Result = PassResults.Last();
+	++Result.Frames;
+	Result.TotalSeconds += L_ReplicationSeconds;
+	Result.MaxSeconds = FMath::Max(Result.MaxSeconds, L_ReplicationSeconds);
+}
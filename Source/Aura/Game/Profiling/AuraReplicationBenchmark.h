@@ -0,0 +1,161 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Engine/TimerHandle.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraReplicationBenchmark.generated.h"
+
+class AAuraEnemy;
+
+/**
+ * @class UAuraReplicationBenchmarkSubsystem
+ * @brief Measures the server replication time with push-model replication disabled and enabled.
+ *
+ * The benchmark acquires the requested number of enemies through UAuraEnemyPoolSubsystem around the first player,
+ * waits WarmupSeconds for their initial replication and then runs two passes of PassSeconds each, the first with
+ * net.IsPushModelEnabled at 0 and the second at 1. Every pass measures the time from the end of the actor tick to the
+ * end of the net driver's tick flush, which is where the net driver compares and sends replicated properties, and
+ * records a CSV profiler capture with the engine's detailed replication timings. The averages and maxima of both
+ * passes are written as a CSV file to Saved/Profiling/AuraReplication, the enemies go back to the pool afterwards and
+ * the console variable gets its previous value.
+ *
+ * Run on a server with the console command Aura.ReplicationBenchmark EnemyClassPath [Enemies] [PassSeconds], for
+ * instance on a dedicated server with 64 connected -nullrhi clients and 500 enemies. The connection count is part of
+ * the results. Push model also needs the NetCore module and push-model enabled properties; without them both passes
+ * measure the same polling cost.
+ */
+UCLASS()
+class AURA_API UAuraReplicationBenchmarkSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Spawns the enemies and starts the first pass once they had WarmupSeconds to replicate.
+	 *
+	 * Does nothing on clients or while a benchmark is running.
+	 *
+	 * @param EnemyClass The class of the spawned enemies.
+	 * @param NumEnemies How many enemies to spawn.
+	 * @param PassSeconds How long each pass measures.
+	 * @param Ar The output device the progress and results are written to.
+	 */
+	void StartBenchmark(TSubclassOf<AAuraEnemy> EnemyClass, int32 NumEnemies, float PassSeconds, FOutputDevice& Ar);
+
+	/**
+	 * @return Whether a benchmark is running.
+	 */
+	bool IsRunning() const { return bRunning; }
+
+protected:
+	/**
+	 * Restricts the subsystem to game and PIE worlds.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Seconds between spawning the enemies and the first pass.
+	 */
+	float WarmupSeconds = 3.f;
+
+private:
+	/**
+	 * The measurements of one pass.
+	 */
+	struct FPassResult
+	{
+		/** The value of net.IsPushModelEnabled during the pass. */
+		int32 PushModelEnabled = 0;
+
+		/** How many frames were measured. */
+		int32 Frames = 0;
+
+		/** Sum of the measured replication times in seconds. */
+		double TotalSeconds = 0.0;
+
+		/** Longest measured replication time in seconds. */
+		double MaxSeconds = 0.0;
+	};
+
+	/**
+	 * Sets net.IsPushModelEnabled for the pass, starts the CSV capture and the measurement.
+	 */
+	void BeginPass(int32 PassIndex);
+
+	/**
+	 * Stops the measurement of the current pass and begins the next one or finishes the benchmark.
+	 */
+	void EndPass();
+
+	/**
+	 * Writes the results, releases the enemies and restores net.IsPushModelEnabled.
+	 */
+	void FinishBenchmark();
+
+	/**
+	 * Writes the results of both passes to a new CSV file in the profiling directory.
+	 */
+	void WriteCsv() const;
+
+	/**
+	 * Remembers when the actor tick of the world ended, right before the tick flush.
+	 */
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/**
+	 * Adds the time since the end of the actor tick to the current pass.
+	 */
+	void OnPostTickFlush(float DeltaSeconds);
+
+	/**
+	 * The enemies spawned for the benchmark, released to the pool once it finishes.
+	 */
+	UPROPERTY()
+	TArray<TObjectPtr<AAuraEnemy>> BenchmarkEnemies;
+
+	/**
+	 * The results of the passes run so far.
+	 */
+	TArray<FPassResult> PassResults;
+
+	/**
+	 * Whether a benchmark is running, from StartBenchmark until the results are written.
+	 */
+	bool bRunning = false;
+
+	/**
+	 * The index of the running pass, INDEX_NONE during the warmup.
+	 */
+	int32 CurrentPassIndex = INDEX_NONE;
+
+	/**
+	 * How long each pass measures.
+	 */
+	float CurrentPassSeconds = 0.f;
+
+	/**
+	 * The value of net.IsPushModelEnabled before the benchmark.
+	 */
+	int32 PreviousPushModelEnabled = 0;
+
+	/**
+	 * The platform time the last actor tick ended, 0 once it was consumed.
+	 */
+	double ActorTickEndTime = 0.0;
+
+	/**
+	 * Handles of the tick delegates bound while a pass runs.
+	 */
+	FDelegateHandle PostActorTickHandle;
+	FDelegateHandle PostTickFlushHandle;
+
+	/**
+	 * Fires the warmup end and the end of each pass.
+	 */
+	FTimerHandle PassTimerHandle;
+};
@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Profiling/AuraStartupProfiler.h"
+
+#include "HAL/PlatformFileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+TArray<FAuraStartupProfiler::FPhase> FAuraStartupProfiler::Phases;
+bool FAuraStartupProfiler::bFinished = false;
+
+void FAuraStartupProfiler::MarkPhase(const TCHAR* PhaseName)
+{
+	if (!IsEnabled() || bFinished || !IsInGameThread())
+	{
+		return;
+	}
+
+	if (Phases.ContainsByPredicate([PhaseName](const FPhase& Phase) { return Phase.Name == PhaseName; }))
+	{
+		return;
+	}
+
+	FPhase& Phase = Phases.AddDefaulted_GetRef();
+	Phase.Name = PhaseName;
+	Phase.TimeSinceStart = FPlatformTime::Seconds() - GStartTime;
+
+	UE_LOG(LogTemp, Log, TEXT("Startup profile: %s at %.3f s"), PhaseName, Phase.TimeSinceStart);
+}
+
+void FAuraStartupProfiler::MarkInteractive()
+{
+	if (!IsEnabled() || bFinished)
+	{
+		return;
+	}
+
+	MarkPhase(TEXT("Interactive"));
+	bFinished = true;
+
+	WriteCsv();
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("AuraStartupProfileExit")))
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+bool FAuraStartupProfiler::IsEnabled()
+{
+	static const bool bEnabled = FParse::Param(FCommandLine::Get(), TEXT("AuraStartupProfile"));
+	return bEnabled;
+}
+
+void FAuraStartupProfiler::WriteCsv()
+{
+	FString L_Csv = TEXT("Phase,TimeSinceStartSeconds,PhaseDurationSeconds\n");
+	double L_PreviousTime = 0.0;
+	for (const FPhase& Phase : Phases)
+	{
+		L_Csv += FString::Printf(TEXT("%s,%.4f,%.4f\n"), *Phase.Name, Phase.TimeSinceStart, Phase.TimeSinceStart - L_PreviousTime);
+		L_PreviousTime = Phase.TimeSinceStart;
+	}
+
+	const FString L_Directory = FPaths::Combine(FPaths::ProfilingDir(), TEXT("AuraStartup"));
+	FPlatformFileManager::Get().GetPlatformFile().CreateDirectoryTree(*L_Directory);
+
+	const FString L_FilePath = FPaths::Combine(L_Directory, FString::Printf(TEXT("Startup-%s.csv"), *FDateTime::Now().ToString()));
+	if (FFileHelper::SaveStringToFile(L_Csv, *L_FilePath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("Startup profile written to %s"), *L_FilePath);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to write the startup profile to %s"), *L_FilePath);
+	}
+}
@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @class FAuraStartupProfiler
+ * @brief Measures the time from engine start to the first frame in which the local player can act.
+ *
+ * Startup code marks the phases it reaches through MarkPhase. Each phase is recorded once, the first time it is
+ * reached, with its time since engine start. MarkInteractive records the last phase and writes the breakdown, with
+ * the duration of every phase, as a CSV file to Saved/Profiling/AuraStartup.
+ *
+ * The profiler is disabled unless the game is started with -AuraStartupProfile, so marks cost a single branch in
+ * regular runs. It has no rendering dependency and works in headless -nullrhi runs. Adding -AuraStartupProfileExit
+ * requests an exit once the CSV is written, for automated join time measurements.
+ */
+class AURA_API FAuraStartupProfiler
+{
+public:
+	/**
+	 * @brief Records that startup reached the given phase.
+	 *
+	 * Does nothing when profiling is disabled, the phase was already recorded or the profile was already written.
+	 *
+	 * @param PhaseName The name of the phase, written as is to the CSV.
+	 */
+	static void MarkPhase(const TCHAR* PhaseName);
+
+	/**
+	 * @brief Records the first frame in which the local player can act and writes the CSV.
+	 *
+	 * Only the first call has an effect.
+	 */
+	static void MarkInteractive();
+
+	/**
+	 * @return Whether the game was started with -AuraStartupProfile.
+	 */
+	static bool IsEnabled();
+
+private:
+	/**
+	 * A recorded phase.
+	 */
+	struct FPhase
+	{
+		FString Name;
+
+		/** Seconds between engine start and the phase. */
+		double TimeSinceStart = 0.0;
+	};
+
+	/**
+	 * Writes the recorded phases to a new CSV file in the profiling directory.
+	 */
+	static void WriteCsv();
+
+	/**
+	 * The recorded phases in the order they were reached.
+	 */
+	static TArray<FPhase> Phases;
+
+	/**
+	 * Whether MarkInteractive already wrote the profile.
+	 */
+	static bool bFinished;
+};
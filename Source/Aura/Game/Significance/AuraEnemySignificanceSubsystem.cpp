@@ -0,0 +1,130 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Significance/AuraEnemySignificanceSubsystem.h"
+
+#include "Game/AuraAssetManager.h"
+#include "Game/Characters/AuraEnemy/AuraEnemy.h"
+#include "Game/Significance/AuraSignificancePolicy.h"
+#include "GameFramework/PlayerController.h"
+
+void UAuraEnemySignificanceSubsystem::RegisterEnemy(AAuraEnemy* Enemy)
+{
+	if (IsValid(Enemy))
+	{
+		EnemyTiers.FindOrAdd(Enemy, INDEX_NONE);
+	}
+}
+
+void UAuraEnemySignificanceSubsystem::UnregisterEnemy(AAuraEnemy* Enemy)
+{
+	EnemyTiers.Remove(Enemy);
+}
+
+void UAuraEnemySignificanceSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (!SignificancePolicy.IsNull())
+	{
+		PolicyLoadHandle = UAuraAssetManager::Get().LoadGameplayAssetsAsync({ SignificancePolicy.ToSoftObjectPath() },
+			FStreamableDelegate::CreateUObject(this, &UAuraEnemySignificanceSubsystem::OnSignificancePolicyLoaded));
+	}
+}
+
+void UAuraEnemySignificanceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!IsValid(LoadedPolicy))
+	{
+		return;
+	}
+
+	TimeSinceEvaluation += DeltaTime;
+	if (TimeSinceEvaluation < LoadedPolicy->EvaluationInterval)
+	{
+		return;
+	}
+	TimeSinceEvaluation = 0.f;
+
+	EvaluateSignificance();
+}
+
+TStatId UAuraEnemySignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraEnemySignificanceSubsystem, STATGROUP_Tickables);
+}
+
+bool UAuraEnemySignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAuraEnemySignificanceSubsystem::OnSignificancePolicyLoaded()
+{
+	LoadedPolicy = SignificancePolicy.Get();
+}
+
+void UAuraEnemySignificanceSubsystem::EvaluateSignificance()
+{
+	struct FPlayerView
+	{
+		FVector Location;
+		FVector Direction;
+	};
+
+	TArray<FPlayerView, TInlineAllocator<4>> L_PlayerViews;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (!IsValid(PC) || PC->GetPawn() == nullptr)
+		{
+			continue;
+		}
+
+		FVector L_ViewLocation;
+		FRotator L_ViewRotation;
+		PC->GetPlayerViewPoint(L_ViewLocation, L_ViewRotation);
+		L_PlayerViews.Add({ L_ViewLocation, L_ViewRotation.Vector() });
+	}
+
+	if (L_PlayerViews.Num() == 0)
+	{
+		return;
+	}
+
+	const float L_ViewConeCos = FMath::Cos(FMath::DegreesToRadians(LoadedPolicy->ViewConeHalfAngle));
+
+	for (auto It = EnemyTiers.CreateIterator(); It; ++It)
+	{
+		AAuraEnemy* Enemy = It.Key().Get();
+		if (!IsValid(Enemy))
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (Enemy->IsHidden())
+		{
+			continue;
+		}
+
+		const FVector L_EnemyLocation = Enemy->GetActorLocation();
+		float L_MinDistanceSquared = TNumericLimits<float>::Max();
+		bool bInView = false;
+		for (const FPlayerView& PlayerView : L_PlayerViews)
+		{
+			const FVector L_ToEnemy = L_EnemyLocation - PlayerView.Location;
+			L_MinDistanceSquared = FMath::Min(L_MinDistanceSquared, static_cast<float>(L_ToEnemy.SizeSquared()));
+			bInView = bInView || FVector::DotProduct(L_ToEnemy.GetSafeNormal(), PlayerView.Direction) >= L_ViewConeCos;
+		}
+
+		const int32 L_TierIndex = LoadedPolicy->GetTierIndex(FMath::Sqrt(L_MinDistanceSquared), bInView);
+		if (L_TierIndex != INDEX_NONE && L_TierIndex != It.Value())
+		{
+			It.Value() = L_TierIndex;
+			Enemy->ApplySignificanceTier(LoadedPolicy->Tiers[L_TierIndex]);
+		}
+	}
+}
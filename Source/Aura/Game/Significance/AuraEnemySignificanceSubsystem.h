@@ -0,0 +1,94 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraEnemySignificanceSubsystem.generated.h"
+
+class AAuraEnemy;
+class UAuraSignificancePolicy;
+
+/**
+ * @class UAuraEnemySignificanceSubsystem
+ * @brief Scores enemies by their distance to and visibility from the players and throttles the insignificant ones.
+ *
+ * Every EvaluationInterval of the policy, each registered enemy is assigned a tier of UAuraSignificancePolicy from its
+ * distance to the nearest player view, and moved down when it is outside every player's view cone. When the tier of an
+ * enemy changes, its settings are applied through AAuraEnemy::ApplySignificanceTier: net update frequency on the server,
+ * ability system component tick interval, and skeletal mesh tick interval and visibility based animation ticking.
+ *
+ * The server scores against all player controllers, clients against their local ones. The policy is a soft reference
+ * set in the Game config and streamed in when the world begins play. Hidden enemies, like pooled ones, are skipped.
+ */
+UCLASS(Config = Game)
+class AURA_API UAuraEnemySignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Starts scoring an enemy.
+	 *
+	 * @param Enemy The enemy entering play.
+	 */
+	void RegisterEnemy(AAuraEnemy* Enemy);
+
+	/**
+	 * @brief Stops scoring an enemy.
+	 *
+	 * @param Enemy The enemy leaving play.
+	 */
+	void UnregisterEnemy(AAuraEnemy* Enemy);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/**
+	 * Restricts the subsystem to game and PIE worlds.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/**
+	 * The policy describing the significance tiers.
+	 */
+	UPROPERTY(Config)
+	TSoftObjectPtr<UAuraSignificancePolicy> SignificancePolicy;
+
+private:
+	/**
+	 * Called once the policy is loaded.
+	 */
+	void OnSignificancePolicyLoaded();
+
+	/**
+	 * Reevaluates the tier of every registered enemy and applies the tiers that changed.
+	 */
+	void EvaluateSignificance();
+
+	/**
+	 * The loaded policy, null until the load completes.
+	 */
+	UPROPERTY()
+	TObjectPtr<UAuraSignificancePolicy> LoadedPolicy = nullptr;
+
+	/**
+	 * Handle of the policy load.
+	 */
+	TSharedPtr<FStreamableHandle> PolicyLoadHandle;
+
+	/**
+	 * The tier index currently applied to each registered enemy, INDEX_NONE before the first evaluation.
+	 */
+	TMap<TWeakObjectPtr<AAuraEnemy>, int32> EnemyTiers;
+
+	/**
+	 * Time accumulated since the last evaluation.
+	 */
+	float TimeSinceEvaluation = 0.f;
+};
@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Significance/AuraSignificancePolicy.h"
+
+int32 UAuraSignificancePolicy::GetTierIndex(float Distance, bool bInView) const
+{
+	if (Tiers.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 R_TierIndex = Tiers.Num() - 1;
+	for (int32 Index = 0; Index < Tiers.Num(); ++Index)
+	{
+		if (Distance <= Tiers[Index].MaxDistance)
+		{
+			R_TierIndex = Index;
+			break;
+		}
+	}
+
+	if (!bInView)
+	{
+		R_TierIndex = FMath::Min(R_TierIndex + FMath::Max(OutOfViewTierOffset, 0), Tiers.Num() - 1);
+	}
+
+	return R_TierIndex;
+}
@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "Engine/DataAsset.h"
+#include "AuraSignificancePolicy.generated.h"
+
+/**
+ * FAuraSignificanceTier holds the update settings applied to enemies of one significance level.
+ */
+USTRUCT(BlueprintType)
+struct FAuraSignificanceTier
+{
+	GENERATED_BODY()
+
+	/**
+	 * Enemies up to this distance from the nearest player view belong to this tier, unless an earlier tier matches.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	float MaxDistance = 2000.f;
+
+	/**
+	 * How often per second the server considers replicating the enemy.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	float NetUpdateFrequency = 100.f;
+
+	/**
+	 * Tick interval of the ability system component in seconds. 0 ticks every frame.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	float AbilitySystemTickInterval = 0.f;
+
+	/**
+	 * Tick interval of the skeletal meshes in seconds, which drives how often their animation is updated. 0 ticks every frame.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	float MeshTickInterval = 0.f;
+
+	/**
+	 * Whether the skeletal meshes keep ticking their pose and bones while not rendered.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	EVisibilityBasedAnimTickOption VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+};
+
+/**
+ * UAuraSignificancePolicy is a data asset describing how enemies are throttled depending on their significance.
+ * Significance is scored by the distance to the nearest player view and by whether the enemy is inside the view cone.
+ */
+UCLASS()
+class AURA_API UAuraSignificancePolicy : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Returns the index of the tier an enemy belongs to.
+	 *
+	 * @param Distance The distance between the enemy and the nearest player view.
+	 * @param bInView Whether the enemy is inside the view cone of any player.
+	 * @return The index into Tiers, or INDEX_NONE if there are no tiers.
+	 */
+	int32 GetTierIndex(float Distance, bool bInView) const;
+
+	/**
+	 * The tiers from most to least significant, ordered by ascending MaxDistance.
+	 * Enemies beyond the MaxDistance of the last tier belong to the last tier.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	TArray<FAuraSignificanceTier> Tiers;
+
+	/**
+	 * Half angle in degrees of the cone in front of a player's view in which enemies count as in view.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	float ViewConeHalfAngle = 60.f;
+
+	/**
+	 * Number of tiers an enemy outside every view cone is moved down.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	int32 OutOfViewTierOffset = 1;
+
+	/**
+	 * Time in seconds between two significance evaluations.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
+	float EvaluationInterval = 0.25f;
+};
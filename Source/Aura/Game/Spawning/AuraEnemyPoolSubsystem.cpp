@@ -0,0 +1,126 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Spawning/AuraEnemyPoolSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "Game/Characters/AuraEnemy/AuraEnemy.h"
+
+AAuraEnemy* UAuraEnemyPoolSubsystem::AcquireEnemy(TSubclassOf<AAuraEnemy> EnemyClass, const FTransform& SpawnTransform, bool bInitializeCombatDefaults)
+{
+	if (!EnemyClass)
+	{
+		return nullptr;
+	}
+
+	AAuraEnemy* R_Enemy = nullptr;
+	if (FAuraEnemyPool* Pool = EnemyPools.Find(EnemyClass))
+	{
+		while (R_Enemy == nullptr && Pool->FreeEnemies.Num() > 0)
+		{
+			AAuraEnemy* L_PooledEnemy = Pool->FreeEnemies.Pop(EAllowShrinking::No);
+			if (IsValid(L_PooledEnemy))
+			{
+				RestoreAttributes(L_PooledEnemy);
+				L_PooledEnemy->ReactivateFromPool(SpawnTransform);
+				R_Enemy = L_PooledEnemy;
+			}
+		}
+	}
+
+	if (R_Enemy == nullptr)
+	{
+		R_Enemy = SpawnEnemy(EnemyClass, SpawnTransform);
+	}
+
+	// The restored base values predate the default effects, which were removed together with the abilities on release.
+	if (bInitializeCombatDefaults && IsValid(R_Enemy))
+	{
+		R_Enemy->InitializeCombatDefaults();
+	}
+
+	return R_Enemy;
+}
+
+void UAuraEnemyPoolSubsystem::ReleaseEnemy(AAuraEnemy* Enemy)
+{
+	if (!IsValid(Enemy))
+	{
+		return;
+	}
+
+	FAuraEnemyPool& Pool = EnemyPools.FindOrAdd(Enemy->GetClass());
+	if (Pool.FreeEnemies.Contains(Enemy))
+	{
+		return;
+	}
+
+	Enemy->DeactivateForPool();
+	Pool.FreeEnemies.Add(Enemy);
+}
+
+void UAuraEnemyPoolSubsystem::Prewarm(TSubclassOf<AAuraEnemy> EnemyClass, int32 Count)
+{
+	if (!EnemyClass)
+	{
+		return;
+	}
+
+	const int32 L_MissingCount = Count - EnemyPools.FindOrAdd(EnemyClass).FreeEnemies.Num();
+	for (int32 Index = 0; Index < L_MissingCount; ++Index)
+	{
+		if (AAuraEnemy* L_Enemy = SpawnEnemy(EnemyClass, FTransform::Identity))
+		{
+			ReleaseEnemy(L_Enemy);
+		}
+	}
+}
+
+bool UAuraEnemyPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+AAuraEnemy* UAuraEnemyPoolSubsystem::SpawnEnemy(TSubclassOf<AAuraEnemy> EnemyClass, const FTransform& SpawnTransform)
+{
+	FActorSpawnParameters L_SpawnParameters;
+	L_SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	AAuraEnemy* R_Enemy = GetWorld()->SpawnActor<AAuraEnemy>(EnemyClass, SpawnTransform, L_SpawnParameters);
+	if (!IsValid(R_Enemy) || AttributeArchetypes.Contains(EnemyClass))
+	{
+		return R_Enemy;
+	}
+
+	// BeginPlay already initialized the ability actor info, so the attributes hold the values of a fresh enemy.
+	const UAbilitySystemComponent* L_ASC = R_Enemy->GetAbilitySystemComponent();
+	const UAttributeSet* L_AttributeSet = R_Enemy->GetAttributeSet();
+	if (IsValid(L_ASC) && IsValid(L_AttributeSet))
+	{
+		FAuraEnemyAttributeArchetype& Archetype = AttributeArchetypes.Add(EnemyClass);
+		UAttributeSet::GetAttributesFromSetClass(L_AttributeSet->GetClass(), Archetype.Attributes);
+
+		Archetype.BaseValues.Reserve(Archetype.Attributes.Num());
+		for (const FGameplayAttribute& Attribute : Archetype.Attributes)
+		{
+			Archetype.BaseValues.Add(L_ASC->GetNumericAttributeBase(Attribute));
+		}
+	}
+
+	return R_Enemy;
+}
+
+void UAuraEnemyPoolSubsystem::RestoreAttributes(AAuraEnemy* Enemy) const
+{
+	const FAuraEnemyAttributeArchetype* Archetype = AttributeArchetypes.Find(Enemy->GetClass());
+	UAbilitySystemComponent* L_ASC = Enemy->GetAbilitySystemComponent();
+	if (Archetype == nullptr || !IsValid(L_ASC))
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < Archetype->Attributes.Num(); ++Index)
+	{
+		L_ASC->SetNumericAttributeBase(Archetype->Attributes[Index], Archetype->BaseValues[Index]);
+	}
+}
@@ -0,0 +1,118 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraEnemyPoolSubsystem.generated.h"
+
+class AAuraEnemy;
+
+/**
+ * @brief The base attribute values of a freshly spawned enemy of one class.
+ *
+ * Captured once per class from the first enemy spawned by the pool and written back to every enemy reused from it,
+ * so that a recycled enemy starts with the same attributes as a new one.
+ */
+struct FAuraEnemyAttributeArchetype
+{
+	TArray<FGameplayAttribute> Attributes;
+
+	/** Base values, parallel to Attributes. */
+	TArray<float> BaseValues;
+};
+
+/**
+ * @brief The pooled enemies of a single enemy class.
+ *
+ * Wrapped in a struct so the pool map can be a UPROPERTY and keep its enemies referenced for the garbage collector.
+ */
+USTRUCT()
+struct FAuraEnemyPool
+{
+	GENERATED_BODY()
+
+	/**
+	 * Deactivated enemies of one class, ready to be brought back into play.
+	 */
+	UPROPERTY()
+	TArray<TObjectPtr<AAuraEnemy>> FreeEnemies;
+};
+
+/**
+ * @class UAuraEnemyPoolSubsystem
+ * @brief Recycles enemies instead of destroying and spawning them.
+ *
+ * Spawning an enemy constructs the actor and its ability system component and attribute set, registers all of its
+ * components and runs InitAbilityActorInfo. Enemies released to the pool keep all of that. Acquiring a pooled enemy
+ * restores the attribute base values captured from the first enemy of its class, refreshes the ability actor info
+ * and teleports the actor, which is a small fraction of the spawn cost. Releasing removes every effect and ability,
+ * so acquiring re-applies the default attribute effects and grants the startup abilities again, the same as for a
+ * newly spawned enemy.
+ *
+ * Only the server acquires and releases enemies. Clients see the pooled actor hidden and without collision.
+ */
+UCLASS()
+class AURA_API UAuraEnemyPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Returns an enemy of the given class at the given transform, reused from the pool when possible.
+	 *
+	 * @param EnemyClass The class of the enemy.
+	 * @param SpawnTransform Where the enemy enters play.
+	 * @param bInitializeCombatDefaults Whether to run AAuraEnemy::InitializeCombatDefaults on the enemy. Only callers
+	 *        that run it themselves later, like UAuraWaveSpawnerSubsystem, should pass false.
+	 * @return The enemy, or nullptr if a new one could not be spawned.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Enemy Pool")
+	AAuraEnemy* AcquireEnemy(TSubclassOf<AAuraEnemy> EnemyClass, const FTransform& SpawnTransform, bool bInitializeCombatDefaults = true);
+
+	/**
+	 * @brief Takes a dead or despawned enemy out of play and keeps it for the next AcquireEnemy of its class.
+	 *
+	 * @param Enemy The enemy to release. Releasing an enemy twice has no effect.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Enemy Pool")
+	void ReleaseEnemy(AAuraEnemy* Enemy);
+
+	/**
+	 * @brief Spawns enemies of the given class into the pool ahead of time, for instance while a level loads.
+	 *
+	 * @param EnemyClass The class of the enemies.
+	 * @param Count How many pooled enemies of the class should be available afterwards.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Enemy Pool")
+	void Prewarm(TSubclassOf<AAuraEnemy> EnemyClass, int32 Count);
+
+protected:
+	/**
+	 * Restricts the subsystem to game and PIE worlds.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Spawns a new enemy and captures the attribute archetype of its class if this is the first one.
+	 */
+	AAuraEnemy* SpawnEnemy(TSubclassOf<AAuraEnemy> EnemyClass, const FTransform& SpawnTransform);
+
+	/**
+	 * Writes the captured base values of the enemy's class back to its attribute set.
+	 */
+	void RestoreAttributes(AAuraEnemy* Enemy) const;
+
+	/**
+	 * Idle enemies keyed by their class.
+	 */
+	UPROPERTY()
+	TMap<TSubclassOf<AAuraEnemy>, FAuraEnemyPool> EnemyPools;
+
+	/**
+	 * The attribute base values of a freshly spawned enemy, per class.
+	 */
+	TMap<TSubclassOf<AAuraEnemy>, FAuraEnemyAttributeArchetype> AttributeArchetypes;
+};
@@ -0,0 +1,136 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/Spawning/AuraWaveSpawnerSubsystem.h"
+
+#include "Engine/World.h"
+#include "Game/Characters/AuraEnemy/AuraEnemy.h"
+#include "Game/Spawning/AuraEnemyPoolSubsystem.h"
+#include "GameFramework/PlayerController.h"
+
+void UAuraWaveSpawnerSubsystem::QueueSpawn(TSubclassOf<AAuraEnemy> EnemyClass, const FTransform& SpawnTransform)
+{
+	if (!EnemyClass || GetWorld()->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	FAuraEnemySpawnRequest& Request = PendingRequests.AddDefaulted_GetRef();
+	Request.EnemyClass = EnemyClass;
+	Request.SpawnTransform = SpawnTransform;
+}
+
+void UAuraWaveSpawnerSubsystem::QueueWave(const TArray<FAuraEnemySpawnRequest>& Requests)
+{
+	PendingRequests.Reserve(PendingRequests.Num() + Requests.Num());
+	for (const FAuraEnemySpawnRequest& Request : Requests)
+	{
+		QueueSpawn(Request.EnemyClass, Request.SpawnTransform);
+	}
+}
+
+void UAuraWaveSpawnerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingRequests.Num() == 0 && PendingInitialization.Num() == 0)
+	{
+		return;
+	}
+
+	const double L_Deadline = FPlatformTime::Seconds() + FrameBudgetMilliseconds / 1000.0;
+	bool bDidWork = false;
+	auto HasBudget = [&L_Deadline, &bDidWork]()
+	{
+		return !bDidWork || FPlatformTime::Seconds() < L_Deadline;
+	};
+
+	// Enemies spawned in an earlier frame are initialized first, so a wave never piles up half initialized enemies.
+	// Enemies whose assets are still streaming in wait, so that their initialization runs synchronously in the budget.
+	int32 L_RemainingCount = 0;
+	for (int32 Index = 0; Index < PendingInitialization.Num(); ++Index)
+	{
+		AAuraEnemy* L_Enemy = PendingInitialization[Index].Get();
+		if (!IsValid(L_Enemy))
+		{
+			continue;
+		}
+
+		if (!HasBudget() || !L_Enemy->PreloadCombatDefaults())
+		{
+			PendingInitialization[L_RemainingCount++] = L_Enemy;
+			continue;
+		}
+
+		L_Enemy->InitializeCombatDefaults();
+		OnEnemySpawned.Broadcast(L_Enemy);
+		bDidWork = true;
+	}
+	PendingInitialization.SetNum(L_RemainingCount, EAllowShrinking::No);
+
+	if (PendingRequests.Num() == 0 || !HasBudget())
+	{
+		return;
+	}
+
+	UAuraEnemyPoolSubsystem* EnemyPool = GetWorld()->GetSubsystem<UAuraEnemyPoolSubsystem>();
+	if (!IsValid(EnemyPool))
+	{
+		return;
+	}
+
+	SortPendingRequests();
+
+	while (PendingRequests.Num() > 0 && HasBudget())
+	{
+		const FAuraEnemySpawnRequest Request = PendingRequests.Pop(EAllowShrinking::No);
+		if (AAuraEnemy* L_Enemy = EnemyPool->AcquireEnemy(Request.EnemyClass, Request.SpawnTransform, false))
+		{
+			PendingInitialization.Add(L_Enemy);
+		}
+		bDidWork = true;
+	}
+}
+
+TStatId UAuraWaveSpawnerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraWaveSpawnerSubsystem, STATGROUP_Tickables);
+}
+
+bool UAuraWaveSpawnerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAuraWaveSpawnerSubsystem::SortPendingRequests()
+{
+	TArray<FVector, TInlineAllocator<4>> L_PlayerLocations;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PC = It->Get(); IsValid(PC) && PC->GetPawn() != nullptr)
+		{
+			L_PlayerLocations.Add(PC->GetPawn()->GetActorLocation());
+		}
+	}
+
+	if (L_PlayerLocations.Num() == 0)
+	{
+		return;
+	}
+
+	for (FAuraEnemySpawnRequest& Request : PendingRequests)
+	{
+		const FVector L_SpawnLocation = Request.SpawnTransform.GetLocation();
+		Request.PriorityDistanceSquared = TNumericLimits<double>::Max();
+		for (const FVector& PlayerLocation : L_PlayerLocations)
+		{
+			Request.PriorityDistanceSquared = FMath::Min(Request.PriorityDistanceSquared, FVector::DistSquared(L_SpawnLocation, PlayerLocation));
+		}
+	}
+
+	// Farthest first, so that popping from the back yields the nearest request.
+	PendingRequests.Sort([](const FAuraEnemySpawnRequest& A, const FAuraEnemySpawnRequest& B)
+	{
+		return A.PriorityDistanceSquared > B.PriorityDistanceSquared;
+	});
+}
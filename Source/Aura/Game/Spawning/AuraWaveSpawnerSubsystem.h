@@ -0,0 +1,114 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraWaveSpawnerSubsystem.generated.h"
+
+class AAuraEnemy;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWaveEnemySpawned, AAuraEnemy*, Enemy);
+
+/**
+ * @brief A queued enemy spawn.
+ */
+USTRUCT(BlueprintType)
+struct FAuraEnemySpawnRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawning")
+	TSubclassOf<AAuraEnemy> EnemyClass = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawning")
+	FTransform SpawnTransform;
+
+	/**
+	 * Squared distance to the nearest player pawn, refreshed every tick while the request is queued.
+	 */
+	double PriorityDistanceSquared = 0.0;
+};
+
+/**
+ * @class UAuraWaveSpawnerSubsystem
+ * @brief Spawns queued enemies over several frames under a per-frame time budget.
+ *
+ * Spawning a wave in one go constructs every actor, applies every default attribute effect and grants every ability
+ * in the same frame. The spawner queues the requests instead and works through them in two steps, each one counted
+ * against FrameBudgetMilliseconds:
+ * - acquiring the actor from UAuraEnemyPoolSubsystem, which reuses a pooled enemy or spawns a new one;
+ * - applying the default attributes and granting the abilities, in a later frame and only once the enemy's
+ *   character assets are loaded, so that this step completes inside the budget instead of in a streaming callback.
+ *
+ * Every tick the queued requests are ordered by the distance to the nearest player pawn, so enemies close to players
+ * appear first. At least one step runs per frame, so a budget that is too small slows the wave down but never stalls
+ * it. Requests are only accepted with authority.
+ */
+UCLASS(Config = Game)
+class AURA_API UAuraWaveSpawnerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Queues a single enemy spawn.
+	 *
+	 * @param EnemyClass The class of the enemy.
+	 * @param SpawnTransform Where the enemy enters play.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Spawning")
+	void QueueSpawn(TSubclassOf<AAuraEnemy> EnemyClass, const FTransform& SpawnTransform);
+
+	/**
+	 * @brief Queues a whole wave of spawns.
+	 *
+	 * @param Requests The spawns of the wave. Requests without an enemy class are skipped.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Spawning")
+	void QueueWave(const TArray<FAuraEnemySpawnRequest>& Requests);
+
+	/**
+	 * @return The number of enemies that are queued or not initialized yet.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Spawning")
+	int32 GetPendingSpawnCount() const { return PendingRequests.Num() + PendingInitialization.Num(); }
+
+	/**
+	 * Broadcast once a queued enemy is spawned and its default attributes and abilities are applied.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Spawning")
+	FOnWaveEnemySpawned OnEnemySpawned;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/**
+	 * Restricts the subsystem to game and PIE worlds.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/**
+	 * Time in milliseconds the spawner may spend per frame.
+	 */
+	UPROPERTY(Config)
+	float FrameBudgetMilliseconds = 2.f;
+
+private:
+	/**
+	 * Refreshes the priority distance of every queued request and sorts the queue so the nearest request is last.
+	 */
+	void SortPendingRequests();
+
+	/**
+	 * Queued requests, the nearest to a player last.
+	 */
+	TArray<FAuraEnemySpawnRequest> PendingRequests;
+
+	/**
+	 * Spawned enemies waiting for their default attributes and abilities, in spawn order.
+	 */
+	TArray<TWeakObjectPtr<AAuraEnemy>> PendingInitialization;
+};
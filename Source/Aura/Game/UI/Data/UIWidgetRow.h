@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Engine/DataTable.h"
+#include "UIWidgetRow.generated.h"
+
+class UAuraUserWidget;
+class UTexture2D;
+
+/**
+ * Represents a row in a data table containing user interface widget data.
+ * This structure is used to define UI elements associated with specific gameplay tags.
+ */
+USTRUCT(BlueprintType)
+struct FUIWidgetRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	/**
+	 * A gameplay tag that serves as an identifier or category for the associated UI message.
+	 * This variable is editable in the editor and is read-only in blueprints.
+	 * Primarily used in FUIWidgetRow to tag specific rows with a unique identifier
+	 * that can correspond to a specific type of UI message or action.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	FGameplayTag MessageTag = FGameplayTag();
+
+	/**
+	 * A localized text variable used to store displayable text data.
+	 * This variable is editable in the property editor and can be read-only within Blueprints.
+	 * It is primarily designed for user-facing UI widgets to display specific messages or information.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	FText Message = FText();
+
+	/**
+	 * A property that holds a class reference to a subclass of UAuraUserWidget.
+	 * The widget represented by this property can be used to display messages
+	 * or other UI elements within the context of a gameplay framework.
+	 *
+	 * This property is editable in both the editor and through blueprints,
+	 * but can only be read in blueprints. The exact class must derive from UAuraUserWidget.
+	 *
+	 * Soft reference, so that loading the message table does not load every message widget. Rows broadcast by
+	 * UOverlayWidgetController have their assets resident already, so resolving the reference never loads.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TSoftClassPtr<UAuraUserWidget> MessageWidget = nullptr;
+
+	/**
+	 * A UTexture2D object representing an image associated with the widget.
+	 * This property is editable in the editor and read-only in Blueprints.
+	 * It is initialized to nullptr and can be assigned a valid texture to display or use as needed.
+	 *
+	 * Soft reference, streamed in together with MessageWidget when the row is first used or prefetched.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TSoftObjectPtr<UTexture2D> Image = nullptr;
+};
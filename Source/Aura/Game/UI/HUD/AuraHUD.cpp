@@ -4,6 +4,9 @@
 #include "AuraHUD.h"
 
 #include "Aura/Game/UI//Widget/AuraUserWidget.h"
+#include "Game/AuraAssetManager.h"
+#include "Game/Profiling/AuraStartupProfiler.h"
+#include "Game/UI/Widget/AuraCombatTextWidget.h"
 #include "Aura/Game/UI/WidgetController/OverlayWidgetController/OverlayWidgetController.h"
 #include "Game/UI/WidgetController/AttributeMenuWidgetController/AttributeMenuWidgetController.h"
 
@@ -11,10 +14,14 @@ UOverlayWidgetController* AAuraHUD::GetOverlayWidgetController(const FWidgetCont
 {
 	if (!IsValid(OverlayWidgetController))
 	{
-		OverlayWidgetController = NewObject<UOverlayWidgetController>(this, OverlayWidgetControllerClass);
+		OverlayWidgetController = NewObject<UOverlayWidgetController>(this, OverlayWidgetControllerClass.LoadSynchronous());
 		OverlayWidgetController->SetWidgetControlParams(WCParams);
 		OverlayWidgetController->BindCallbacksToDependencies();
 	}
+	else if (!OverlayWidgetController->HasWidgetControlParams(WCParams))
+	{
+		RebindWidgetController(OverlayWidgetController, WCParams);
+	}
 
 	return OverlayWidgetController;
 }
@@ -23,27 +30,143 @@ UAttributeMenuWidgetController* AAuraHUD::GetAttributeMenuWidgetController(const
 {
 	if (!IsValid(AttributeMenuWidgetController))
 	{
-		AttributeMenuWidgetController = NewObject<UAttributeMenuWidgetController>(this, AttributeMenuWidgetControllerClass);
+		AttributeMenuWidgetController = NewObject<UAttributeMenuWidgetController>(this, AttributeMenuWidgetControllerClass.LoadSynchronous());
 		AttributeMenuWidgetController->SetWidgetControlParams(WCParams);
 		AttributeMenuWidgetController->BindCallbacksToDependencies();
 	}
+	else if (!AttributeMenuWidgetController->HasWidgetControlParams(WCParams))
+	{
+		RebindWidgetController(AttributeMenuWidgetController, WCParams);
+	}
 
 	return AttributeMenuWidgetController;
 }
 
 void AAuraHUD::InitOverlay(APlayerController* PC, APlayerState* PS, UAbilitySystemComponent* ASC, UAttributeSet* AS)
 {
-	if (OverlayWidgetClass)
+	if (OverlayWidgetClass.IsNull())
+	{
+		return;
+	}
+
+	FAuraStartupProfiler::MarkPhase(TEXT("InitOverlay"));
+
+	PendingOverlayParams = FWidgetControllerParams(PC, PS, ASC, AS);
+
+	if (OverlayLoadHandle.IsValid() && OverlayLoadHandle->IsLoadingInProgress())
+	{
+		// The pending load picks up the new params when it completes.
+		return;
+	}
+
+	const TArray<FSoftObjectPath> L_AssetsToLoad = { OverlayWidgetClass.ToSoftObjectPath(), OverlayWidgetControllerClass.ToSoftObjectPath() };
+	OverlayLoadHandle = UAuraAssetManager::Get().LoadUIAssetsAsync(L_AssetsToLoad, FStreamableDelegate::CreateUObject(this, &AAuraHUD::OnOverlayAssetsLoaded));
+}
+
+void AAuraHUD::OnOverlayAssetsLoaded()
+{
+	UClass* L_OverlayWidgetClass = OverlayWidgetClass.Get();
+	if (L_OverlayWidgetClass == nullptr || !IsValid(PendingOverlayParams.PlayerController))
+	{
+		return;
+	}
+
+	// Owned by the HUD's player, so widgets resolve their split-screen player through GetOwningLocalPlayer.
+	UUserWidget* L_Widget = CreateWidget(GetOwningPlayerController(), L_OverlayWidgetClass);
+	OverlayWidget = Cast<UAuraUserWidget>(L_Widget);
+
+	UOverlayWidgetController* L_WidgetController = GetOverlayWidgetController(PendingOverlayParams);
+	PendingOverlayParams = FWidgetControllerParams();
+
+	OverlayWidget->SetWidgetController(L_WidgetController);
+	L_WidgetController->BroadcastInitialValues();
+
+	L_Widget->AddToViewport();
+
+	FAuraStartupProfiler::MarkPhase(TEXT("OverlayCreated"));
+}
+
+void AAuraHUD::RebindWidgetController(UAuraWidgetController* WidgetController, const FWidgetControllerParams& WCParams)
+{
+	WidgetController->UnbindCallbacksFromDependencies();
+	WidgetController->SetWidgetControlParams(WCParams);
+	WidgetController->BindCallbacksToDependencies();
+	WidgetController->BroadcastInitialValues();
+}
+
+UAuraUserWidget* AAuraHUD::AcquireMessageWidget(const FUIWidgetRow& Row)
+{
+	// Rows broadcast by the overlay widget controller are already resident, this only loads for rows from elsewhere.
+	const TSubclassOf<UAuraUserWidget> L_WidgetClass = Row.MessageWidget.LoadSynchronous();
+	if (!L_WidgetClass)
 	{
-		UUserWidget* L_Widget = CreateWidget(GetWorld(), OverlayWidgetClass);
-		OverlayWidget = Cast<UAuraUserWidget>(L_Widget);
+		return nullptr;
+	}
+
+	if (MaxVisibleMessageWidgets > 0 && ActiveMessageWidgets.Num() >= MaxVisibleMessageWidgets)
+	{
+		ReleaseMessageWidget(ActiveMessageWidgets[0]);
+	}
+
+	UAuraUserWidget* R_Widget = nullptr;
+	FAuraMessageWidgetPool& Pool = MessageWidgetPools.FindOrAdd(L_WidgetClass);
+	while (R_Widget == nullptr && Pool.FreeWidgets.Num() > 0)
+	{
+		UAuraUserWidget* L_PooledWidget = Pool.FreeWidgets.Pop(EAllowShrinking::No);
+		R_Widget = IsValid(L_PooledWidget) ? L_PooledWidget : nullptr;
+	}
+
+	if (R_Widget == nullptr)
+	{
+		R_Widget = CreateWidget<UAuraUserWidget>(GetOwningPlayerController(), L_WidgetClass);
+		if (R_Widget == nullptr)
+		{
+			return nullptr;
+		}
+	}
+
+	ActiveMessageWidgets.Add(R_Widget);
+	++R_Widget->MessageSerial;
+
+	if (!R_Widget->GetParent() && !R_Widget->IsInViewport())
+	{
+		R_Widget->AddToViewport();
+	}
+	R_Widget->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
+	R_Widget->MessageWidgetRowSet(Row);
 
-		const FWidgetControllerParams WidgetControllerParams(PC, PS, ASC, AS);
-		UOverlayWidgetController* L_WidgetController = GetOverlayWidgetController(WidgetControllerParams);
+	return R_Widget;
+}
+
+bool AAuraHUD::ReleaseMessageWidget(UAuraUserWidget* MessageWidget)
+{
+	if (!IsValid(MessageWidget) || ActiveMessageWidgets.Remove(MessageWidget) == 0)
+	{
+		return false;
+	}
+
+	++MessageWidget->MessageSerial;
+	MessageWidget->SetVisibility(ESlateVisibility::Collapsed);
+	MessageWidget->MessageWidgetReleased();
+
+	MessageWidgetPools.FindOrAdd(MessageWidget->GetClass()).FreeWidgets.Add(MessageWidget);
+
+	return true;
+}
+
+void AAuraHUD::AddCombatText(AActor* TargetActor, float Amount)
+{
+	if (!IsValid(CombatTextWidget))
+	{
+		const TSubclassOf<UAuraCombatTextWidget> L_WidgetClass = CombatTextWidgetClass ? CombatTextWidgetClass : TSubclassOf<UAuraCombatTextWidget>(UAuraCombatTextWidget::StaticClass());
+		CombatTextWidget = CreateWidget<UAuraCombatTextWidget>(GetOwningPlayerController(), L_WidgetClass);
+		if (!IsValid(CombatTextWidget))
+		{
+			return;
+		}
+
+		CombatTextWidget->AddToViewport();
+	}
 
-		OverlayWidget->SetWidgetController(L_WidgetController);
-		L_WidgetController->BroadcastInitialValues();
-		
-		L_Widget->AddToViewport();
-	}	
+	CombatTextWidget->AddCombatText(TargetActor, Amount);
 }
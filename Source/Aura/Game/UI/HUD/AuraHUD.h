@@ -4,13 +4,35 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/HUD.h"
+#include "Game/UI/Data/UIWidgetRow.h"
+#include "Game/UI/WidgetController/AuraWidgetController/AuraWidgetController.h"
 #include "AuraHUD.generated.h"
 
 class UAttributeMenuWidgetController;
 class UAttributeSet;
 class UAbilitySystemComponent;
 class UOverlayWidgetController;
-struct FWidgetControllerParams;
+class UAuraUserWidget;
+class UAuraCombatTextWidget;
+struct FStreamableHandle;
+
+/**
+ * @brief The idle message widgets of a single message widget class.
+ *
+ * Wrapped in a struct so the pool map can be a UPROPERTY and keep its widgets referenced for the garbage collector.
+ */
+USTRUCT()
+struct FAuraMessageWidgetPool
+{
+	GENERATED_BODY()
+
+	/**
+	 * Hidden widgets of one class, ready to be handed out again by AAuraHUD::AcquireMessageWidget.
+	 */
+	UPROPERTY()
+	TArray<TObjectPtr<UAuraUserWidget>> FreeWidgets;
+};
+
 /**
  * @class AAuraHUD
  * @brief Represents the custom HUD for the Aura game, responsible for managing and initializing UI elements such as overlays and attribute menus.
@@ -29,7 +51,9 @@ public:
 	 *
 	 * This method ensures the Overlay Widget Controller is valid and configured with the provided parameters.
 	 * If the controller does not exist, a new instance is created based on the configured class type,
-	 * and its parameters and callbacks are initialized.
+	 * and its parameters and callbacks are initialized. An existing controller set up with other parameters, e.g. an
+	 * old player state, is rebound to the new ones. The class is normally streamed in by InitOverlay;
+	 * if a widget asks for the controller earlier, the class is loaded synchronously.
 	 *
 	 * @param WCParams A structure containing parameters required to initialize the Widget Controller,
 	 * such as PlayerController, PlayerState, AbilitySystemComponent, and AttributeSet.
@@ -41,6 +65,8 @@ public:
 	 *
 	 * This method checks if the Attribute Menu Widget Controller is valid. If not, it creates a new instance of the controller,
 	 * initializes it with the provided widget controller parameters, and binds any relevant callbacks to dependencies.
+	 * An existing controller set up with other parameters is rebound to the new ones.
+	 * The controller class is a soft reference and is loaded synchronously on first use, when the menu is opened.
 	 *
 	 * @param WCParams A struct containing references to essential gameplay components such as the Player Controller, Player State,
 	 *                 Ability System Component, and Attribute Set, which are required for initializing the controller.
@@ -54,6 +80,10 @@ public:
 	 * This method creates and sets up the user interface overlay widget, linking it to the appropriate widget controller.
 	 * The overlay widget is responsible for displaying HUD elements such as player abilities, health, or other gameplay-specific data.
 	 *
+	 * The overlay widget and controller classes are streamed in through UAuraAssetManager first, so the overlay appears
+	 * once its assets are ready instead of blocking the game thread. Calling this again before the load finished
+	 * replaces the pending parameters.
+	 *
 	 * @param PC A pointer to the player's controller, providing input and gameplay control reference.
 	 * @param PS A pointer to the player's state, used for maintaining persistent gameplay information.
 	 * @param ASC A pointer to the player's ability system component, facilitating interaction with abilities and effects.
@@ -62,7 +92,105 @@ public:
 	UFUNCTION()
 	void InitOverlay(APlayerController* PC, APlayerState* PS, UAbilitySystemComponent* ASC, UAttributeSet* AS);
 
+	/**
+	 * @return Whether the overlay widget was created, which happens asynchronously after InitOverlay.
+	 */
+	bool IsOverlayCreated() const { return IsValid(OverlayWidget); }
+
+	/**
+	 * @brief Hands out a message widget for the given row, reusing a pooled instance of the row's widget class when available.
+	 *
+	 * Replaces creating a new widget per message broadcast through UOverlayWidgetController::MessageWidgetRowDelegate.
+	 * The widget is made visible, added to the viewport if it has no parent yet, and re-initialized through
+	 * UAuraUserWidget::MessageWidgetRowSet. When MaxVisibleMessageWidgets are already on screen, the oldest
+	 * one is released first.
+	 *
+	 * @param Row The message row to display. Its MessageWidget class selects the pool.
+	 * @return The widget displaying the row, or nullptr if the row has no widget class.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UI|Messages")
+	UAuraUserWidget* AcquireMessageWidget(const FUIWidgetRow& Row);
+
+	/**
+	 * @brief Hides a message widget and returns it to the pool of its class.
+	 *
+	 * The widget keeps its parent so that reusing it does not rebuild its Slate hierarchy. Its MessageSerial changes,
+	 * so later releases for the message it displayed are ignored by UAuraUserWidget::ReleaseMessageWidget.
+	 *
+	 * @param MessageWidget A widget previously returned by AcquireMessageWidget.
+	 * @return False if the widget is not an active message widget of this HUD, which leaves it untouched.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UI|Messages")
+	bool ReleaseMessageWidget(UAuraUserWidget* MessageWidget);
+
+	/**
+	 * @brief Shows a floating damage or heal number above the given actor.
+	 *
+	 * All numbers are drawn by a single UAuraCombatTextWidget that is created on first use, so a burst of hits costs
+	 * one array entry per target instead of one widget per number.
+	 *
+	 * @param TargetActor The actor whose health changed.
+	 * @param Amount The health change. Negative values are damage, positive values are healing.
+	 */
+	void AddCombatText(AActor* TargetActor, float Amount);
+
 private:
+	/**
+	 * @brief Creates the overlay widget and its controller once their classes are loaded.
+	 */
+	void OnOverlayAssetsLoaded();
+
+	/**
+	 * @brief Moves a widget controller to new dependencies and broadcasts their current values.
+	 *
+	 * @param WidgetController The controller to rebind.
+	 * @param WCParams The new dependencies.
+	 */
+	void RebindWidgetController(UAuraWidgetController* WidgetController, const FWidgetControllerParams& WCParams);
+
+	/**
+	 * @brief The widget controller params passed to the last InitOverlay call, consumed by OnOverlayAssetsLoaded.
+	 */
+	UPROPERTY()
+	FWidgetControllerParams PendingOverlayParams;
+
+	/**
+	 * @brief Keeps the overlay classes resident while the overlay exists.
+	 */
+	TSharedPtr<FStreamableHandle> OverlayLoadHandle;
+
+	/**
+	 * @brief The widget class drawing floating combat text. Falls back to UAuraCombatTextWidget when unset.
+	 */
+	UPROPERTY(EditAnywhere, Category = "UI|CombatText")
+	TSubclassOf<UAuraCombatTextWidget> CombatTextWidgetClass = nullptr;
+
+	/**
+	 * @brief The single widget drawing all floating combat text of this HUD.
+	 */
+	UPROPERTY()
+	TObjectPtr<UAuraCombatTextWidget> CombatTextWidget = nullptr;
+
+	/**
+	 * @brief Maximum number of message widgets displayed at the same time.
+	 *
+	 * Acquiring a message widget beyond this cap recycles the oldest visible one. A value of 0 disables the cap.
+	 */
+	UPROPERTY(EditAnywhere, Category = "UI|Messages", meta = (ClampMin = 0))
+	int32 MaxVisibleMessageWidgets = 4;
+
+	/**
+	 * @brief Idle message widgets keyed by their widget class.
+	 */
+	UPROPERTY()
+	TMap<TSubclassOf<UAuraUserWidget>, FAuraMessageWidgetPool> MessageWidgetPools;
+
+	/**
+	 * @brief Message widgets currently on screen, oldest first.
+	 */
+	UPROPERTY()
+	TArray<TObjectPtr<UAuraUserWidget>> ActiveMessageWidgets;
+
 	/**
 	 * @brief Holds a reference to the player's overlay widget used to display dynamic HUD elements.
 	 *
@@ -80,7 +208,7 @@ private:
 	 * of the overlay interface through assignment of different widget classes.
 	 */
 	UPROPERTY(EditAnywhere)
-	TSubclassOf<class UAuraUserWidget> OverlayWidgetClass = nullptr;
+	TSoftClassPtr<UAuraUserWidget> OverlayWidgetClass = nullptr;
 
 	/**
 	 * @var TObjectPtr<UOverlayWidgetController> OverlayWidgetController
@@ -101,7 +229,7 @@ private:
 	 * Used to dynamically create and initialize the overlay controller during gameplay.
 	 */
 	UPROPERTY(EditAnywhere)
-	TSubclassOf<UOverlayWidgetController> OverlayWidgetControllerClass = nullptr;
+	TSoftClassPtr<UOverlayWidgetController> OverlayWidgetControllerClass = nullptr;
 
 	/**
 	 * @property AttributeMenuWidgetController
@@ -122,5 +250,5 @@ private:
 	 * the attribute menu widget's behavior and functionality.
 	 */
 	UPROPERTY(EditAnywhere)
-	TSubclassOf<UAttributeMenuWidgetController> AttributeMenuWidgetControllerClass = nullptr;
+	TSoftClassPtr<UAttributeMenuWidgetController> AttributeMenuWidgetControllerClass = nullptr;
 };
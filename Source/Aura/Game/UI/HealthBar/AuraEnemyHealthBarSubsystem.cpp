@@ -0,0 +1,245 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/UI/HealthBar/AuraEnemyHealthBarSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "Components/WidgetComponent.h"
+#include "Engine/LocalPlayer.h"
+#include "Game/AbilitySystem/AttributeSet/AuraAttributeSet.h"
+#include "Game/Characters/AuraEnemy/AuraEnemy.h"
+#include "Game/UI/Widget/AuraHealthBarWidget.h"
+
+void UAuraEnemyHealthBarSubsystem::RegisterEnemy(AAuraEnemy* Enemy)
+{
+	if (!IsValid(Enemy) || !Enemy->GetHealthBarWidgetClass())
+	{
+		return;
+	}
+
+	UAbilitySystemComponent* L_ASC = Enemy->GetAbilitySystemComponent();
+	const UAuraAttributeSet* L_AttributeSet = Cast<UAuraAttributeSet>(Enemy->GetAttributeSet());
+	if (!IsValid(L_ASC) || !IsValid(L_AttributeSet))
+	{
+		return;
+	}
+
+	FAuraEnemyHealthBarRecord& Record = Records.FindOrAdd(Enemy);
+	UnbindRecord(Record);
+
+	Record.Enemy = Enemy;
+	Record.AbilitySystemComponent = L_ASC;
+	Record.Health = L_AttributeSet->GetHealth();
+	Record.MaxHealth = L_AttributeSet->GetMaxHealth();
+	Record.bDirty = true;
+
+	const TObjectKey<AAuraEnemy> L_EnemyKey(Enemy);
+	Record.HealthChangedHandle = L_ASC->GetGameplayAttributeValueChangeDelegate(L_AttributeSet->GetHealthAttribute()).AddWeakLambda(this,
+		[this, L_EnemyKey](const FOnAttributeChangeData& Data)
+		{
+			if (FAuraEnemyHealthBarRecord* L_Record = Records.Find(L_EnemyKey))
+			{
+				L_Record->Health = Data.NewValue;
+				L_Record->bDirty = true;
+			}
+		});
+	Record.MaxHealthChangedHandle = L_ASC->GetGameplayAttributeValueChangeDelegate(L_AttributeSet->GetMaxHealthAttribute()).AddWeakLambda(this,
+		[this, L_EnemyKey](const FOnAttributeChangeData& Data)
+		{
+			if (FAuraEnemyHealthBarRecord* L_Record = Records.Find(L_EnemyKey))
+			{
+				L_Record->MaxHealth = Data.NewValue;
+				L_Record->bDirty = true;
+			}
+		});
+}
+
+void UAuraEnemyHealthBarSubsystem::UnregisterEnemy(AAuraEnemy* Enemy)
+{
+	if (FAuraEnemyHealthBarRecord* Record = Records.Find(Enemy))
+	{
+		UnbindRecord(*Record);
+		ReleaseHealthBar(*Record);
+		Records.Remove(Enemy);
+	}
+}
+
+bool UAuraEnemyHealthBarSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UAuraEnemyHealthBarSubsystem::Deinitialize()
+{
+	for (TPair<TObjectKey<AAuraEnemy>, FAuraEnemyHealthBarRecord>& Pair : Records)
+	{
+		UnbindRecord(Pair.Value);
+	}
+	Records.Reset();
+
+	Super::Deinitialize();
+}
+
+void UAuraEnemyHealthBarSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const UWorld* World = GetWorld();
+	const APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	if (!IsValid(PC) || !IsValid(PC->PlayerCameraManager))
+	{
+		return;
+	}
+
+	const FVector L_CameraLocation = PC->PlayerCameraManager->GetCameraLocation();
+	const double L_Now = World->GetTimeSeconds();
+	const float L_MaxDistanceSquared = FMath::Square(MaxDistance);
+
+	for (auto It = Records.CreateIterator(); It; ++It)
+	{
+		FAuraEnemyHealthBarRecord& Record = It.Value();
+
+		AAuraEnemy* Enemy = Record.Enemy.Get();
+		if (!IsValid(Enemy))
+		{
+			UnbindRecord(Record);
+			ReleaseHealthBar(Record);
+			It.RemoveCurrent();
+			continue;
+		}
+
+		const float L_DistanceSquared = FVector::DistSquared(L_CameraLocation, Enemy->GetActorLocation());
+		if (!Enemy->WasRecentlyRendered(VisibilityTolerance) || L_DistanceSquared > L_MaxDistanceSquared)
+		{
+			if (Record.HealthBar.IsValid())
+			{
+				ReleaseHealthBar(Record);
+			}
+			continue;
+		}
+
+		if (!Record.HealthBar.IsValid())
+		{
+			AcquireHealthBar(Enemy, Record);
+			if (!Record.HealthBar.IsValid())
+			{
+				continue;
+			}
+
+			// A freshly attached bar always shows the latest values, whatever the interval.
+			PushHealthValues(Record);
+			Record.bDirty = false;
+			Record.LastUpdateTime = L_Now;
+			continue;
+		}
+
+		if (Record.bDirty && L_Now - Record.LastUpdateTime >= GetUpdateInterval(FMath::Sqrt(L_DistanceSquared)))
+		{
+			PushHealthValues(Record);
+			Record.bDirty = false;
+			Record.LastUpdateTime = L_Now;
+		}
+	}
+}
+
+TStatId UAuraEnemyHealthBarSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraEnemyHealthBarSubsystem, STATGROUP_Tickables);
+}
+
+bool UAuraEnemyHealthBarSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAuraEnemyHealthBarSubsystem::AcquireHealthBar(AAuraEnemy* Enemy, FAuraEnemyHealthBarRecord& Record)
+{
+	const TSubclassOf<UAuraHealthBarWidget> L_WidgetClass = Enemy->GetHealthBarWidgetClass();
+	if (!L_WidgetClass)
+	{
+		return;
+	}
+
+	UWidgetComponent* HealthBar = nullptr;
+	FAuraHealthBarComponentPool& Pool = HealthBarPools.FindOrAdd(L_WidgetClass);
+	while (HealthBar == nullptr && Pool.FreeComponents.Num() > 0)
+	{
+		UWidgetComponent* L_PooledComponent = Pool.FreeComponents.Pop(EAllowShrinking::No);
+		HealthBar = IsValid(L_PooledComponent) ? L_PooledComponent : nullptr;
+	}
+
+	if (HealthBar == nullptr)
+	{
+		HealthBar = NewObject<UWidgetComponent>(this);
+		HealthBar->SetWidgetSpace(EWidgetSpace::Screen);
+		HealthBar->SetDrawAtDesiredSize(true);
+		HealthBar->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		HealthBar->SetWidgetClass(L_WidgetClass);
+		if (const APlayerController* PC = GetWorld()->GetFirstPlayerController())
+		{
+			HealthBar->SetOwnerPlayer(PC->GetLocalPlayer());
+		}
+		HealthBar->RegisterComponentWithWorld(GetWorld());
+		HealthBar->InitWidget();
+	}
+
+	HealthBar->AttachToComponent(Enemy->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	HealthBar->SetRelativeLocation(Enemy->GetHealthBarOffset());
+	HealthBar->SetVisibility(true);
+
+	if (UAuraHealthBarWidget* L_Widget = Cast<UAuraHealthBarWidget>(HealthBar->GetUserWidgetObject()))
+	{
+		L_Widget->SetHealthBarOwner(Enemy);
+	}
+
+	ActiveHealthBars.Add(HealthBar);
+	Record.HealthBar = HealthBar;
+}
+
+void UAuraEnemyHealthBarSubsystem::ReleaseHealthBar(FAuraEnemyHealthBarRecord& Record)
+{
+	UWidgetComponent* HealthBar = Record.HealthBar.Get();
+	Record.HealthBar = nullptr;
+
+	if (!IsValid(HealthBar) || ActiveHealthBars.RemoveSwap(HealthBar, EAllowShrinking::No) == 0)
+	{
+		return;
+	}
+
+	HealthBar->SetVisibility(false);
+	HealthBar->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+
+	// Force a push with the latest values the next time the enemy gets a bar.
+	Record.bDirty = true;
+
+	HealthBarPools.FindOrAdd(HealthBar->GetWidgetClass()).FreeComponents.Add(HealthBar);
+}
+
+void UAuraEnemyHealthBarSubsystem::UnbindRecord(FAuraEnemyHealthBarRecord& Record)
+{
+	if (UAbilitySystemComponent* L_ASC = Record.AbilitySystemComponent.Get())
+	{
+		L_ASC->GetGameplayAttributeValueChangeDelegate(UAuraAttributeSet::GetHealthAttribute()).Remove(Record.HealthChangedHandle);
+		L_ASC->GetGameplayAttributeValueChangeDelegate(UAuraAttributeSet::GetMaxHealthAttribute()).Remove(Record.MaxHealthChangedHandle);
+	}
+
+	Record.HealthChangedHandle.Reset();
+	Record.MaxHealthChangedHandle.Reset();
+	Record.AbilitySystemComponent = nullptr;
+}
+
+void UAuraEnemyHealthBarSubsystem::PushHealthValues(const FAuraEnemyHealthBarRecord& Record)
+{
+	if (const UWidgetComponent* HealthBar = Record.HealthBar.Get())
+	{
+		if (UAuraHealthBarWidget* L_Widget = Cast<UAuraHealthBarWidget>(HealthBar->GetUserWidgetObject()))
+		{
+			L_Widget->SetHealthValues(Record.Health, Record.MaxHealth);
+		}
+	}
+}
+
+float UAuraEnemyHealthBarSubsystem::GetUpdateInterval(float Distance) const
+{
+	return FMath::GetMappedRangeValueClamped(FVector2D(NearDistance, FarDistance), FVector2D(NearUpdateInterval, FarUpdateInterval), Distance);
+}
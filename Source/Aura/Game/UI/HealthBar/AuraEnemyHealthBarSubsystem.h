@@ -0,0 +1,192 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraEnemyHealthBarSubsystem.generated.h"
+
+class AAuraEnemy;
+class UAbilitySystemComponent;
+class UAuraHealthBarWidget;
+class UWidgetComponent;
+struct FOnAttributeChangeData;
+
+/**
+ * @brief The health bar state of a single registered enemy.
+ *
+ * Attribute changes only update the cached values and set bDirty. The widget is touched from the subsystem's tick,
+ * and only while the enemy holds a health bar.
+ */
+struct FAuraEnemyHealthBarRecord
+{
+	TWeakObjectPtr<AAuraEnemy> Enemy = nullptr;
+
+	TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent = nullptr;
+
+	FDelegateHandle HealthChangedHandle;
+
+	FDelegateHandle MaxHealthChangedHandle;
+
+	/** The pooled widget component currently attached to the enemy, null while the enemy is off screen. */
+	TWeakObjectPtr<UWidgetComponent> HealthBar = nullptr;
+
+	float Health = 0.f;
+
+	float MaxHealth = 0.f;
+
+	/** World time of the last push to the widget. */
+	double LastUpdateTime = 0.0;
+
+	/** Whether the cached values changed since the last push to the widget. */
+	bool bDirty = true;
+};
+
+/**
+ * @brief The idle health bar components of a single health bar widget class.
+ *
+ * Wrapped in a struct so the pool map can be a UPROPERTY and keep its components referenced for the garbage collector.
+ */
+USTRUCT()
+struct FAuraHealthBarComponentPool
+{
+	GENERATED_BODY()
+
+	/**
+	 * Detached and hidden components of one widget class, ready to be attached to the next visible enemy.
+	 */
+	UPROPERTY()
+	TArray<TObjectPtr<UWidgetComponent>> FreeComponents;
+};
+
+/**
+ * @class UAuraEnemyHealthBarSubsystem
+ * @brief Owns the health bars of all enemies in the world and decides which enemies get one and how often it updates.
+ *
+ * Enemies register once their ability actor info is set. Instead of every bar binding to its enemy's attribute
+ * delegates, the subsystem binds once per enemy and only caches the new values. Every tick it walks the registered
+ * enemies and:
+ * - releases the bar of enemies that were not rendered recently or are farther than MaxDistance, back into a pool;
+ * - attaches a pooled bar to enemies that became visible;
+ * - pushes the cached values of dirty, visible enemies, at most once per update interval. The interval grows from
+ *   NearUpdateInterval to FarUpdateInterval between NearDistance and FarDistance from the camera.
+ *
+ * Off-screen enemies therefore cost a visibility check and no widget work at all. The subsystem is not created on
+ * dedicated servers.
+ */
+UCLASS(Config = Game)
+class AURA_API UAuraEnemyHealthBarSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Starts tracking the health of an enemy.
+	 *
+	 * Binds to the enemy's Health and MaxHealth change delegates. Registering an already registered enemy rebinds it,
+	 * which covers a re-initialized ability system component.
+	 *
+	 * @param Enemy The enemy whose ability actor info has just been set.
+	 */
+	void RegisterEnemy(AAuraEnemy* Enemy);
+
+	/**
+	 * @brief Stops tracking an enemy and returns its health bar to the pool.
+	 *
+	 * @param Enemy The enemy leaving play.
+	 */
+	void UnregisterEnemy(AAuraEnemy* Enemy);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+protected:
+	/**
+	 * Restricts the subsystem to game and PIE worlds.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/**
+	 * Time in seconds an enemy counts as visible after it was last rendered.
+	 */
+	UPROPERTY(Config)
+	float VisibilityTolerance = 0.2f;
+
+	/**
+	 * Enemies farther than this from the camera never hold a health bar.
+	 */
+	UPROPERTY(Config)
+	float MaxDistance = 5000.f;
+
+	/**
+	 * Up to this distance from the camera, bars use NearUpdateInterval.
+	 */
+	UPROPERTY(Config)
+	float NearDistance = 1500.f;
+
+	/**
+	 * From this distance on, bars use FarUpdateInterval.
+	 */
+	UPROPERTY(Config)
+	float FarDistance = 4000.f;
+
+	/**
+	 * Minimum time in seconds between two updates of a near bar. 0 updates on the next tick after a change.
+	 */
+	UPROPERTY(Config)
+	float NearUpdateInterval = 0.f;
+
+	/**
+	 * Minimum time in seconds between two updates of a far bar.
+	 */
+	UPROPERTY(Config)
+	float FarUpdateInterval = 0.25f;
+
+private:
+	/**
+	 * Attaches a pooled or new health bar component to the record's enemy.
+	 */
+	void AcquireHealthBar(AAuraEnemy* Enemy, FAuraEnemyHealthBarRecord& Record);
+
+	/**
+	 * Detaches and hides the record's health bar and returns it to the pool of its widget class.
+	 */
+	void ReleaseHealthBar(FAuraEnemyHealthBarRecord& Record);
+
+	/**
+	 * Removes the attribute change bindings of a record.
+	 */
+	static void UnbindRecord(FAuraEnemyHealthBarRecord& Record);
+
+	/**
+	 * Pushes the cached values of a record to its health bar widget.
+	 */
+	static void PushHealthValues(const FAuraEnemyHealthBarRecord& Record);
+
+	/**
+	 * Returns the minimum time between two updates of a bar at the given distance from the camera.
+	 */
+	float GetUpdateInterval(float Distance) const;
+
+	/**
+	 * All registered enemies.
+	 */
+	TMap<TObjectKey<AAuraEnemy>, FAuraEnemyHealthBarRecord> Records;
+
+	/**
+	 * Idle health bar components keyed by their widget class.
+	 */
+	UPROPERTY()
+	TMap<TSubclassOf<UAuraHealthBarWidget>, FAuraHealthBarComponentPool> HealthBarPools;
+
+	/**
+	 * Health bar components currently attached to an enemy.
+	 */
+	UPROPERTY()
+	TArray<TObjectPtr<UWidgetComponent>> ActiveHealthBars;
+};
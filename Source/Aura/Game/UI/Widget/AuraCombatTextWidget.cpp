@@ -0,0 +1,166 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/UI/Widget/AuraCombatTextWidget.h"
+
+#include "Blueprint/WidgetLayoutLibrary.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+
+UAuraCombatTextWidget::UAuraCombatTextWidget(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	Font = FCoreStyle::GetDefaultFontStyle("Bold", 20);
+}
+
+void UAuraCombatTextWidget::AddCombatText(AActor* TargetActor, float Amount)
+{
+	if (!IsValid(TargetActor) || FMath::IsNearlyZero(Amount))
+	{
+		return;
+	}
+
+	TMap<TObjectKey<AActor>, int32>& OpenEntries = GetOpenEntries(Amount);
+	if (const int32* L_OpenIndex = OpenEntries.Find(TargetActor))
+	{
+		FAuraCombatTextEntry& Entry = Entries[*L_OpenIndex];
+		Entry.Amount += Amount;
+		Entry.Text = FString::FromInt(FMath::RoundToInt(FMath::Abs(Entry.Amount)));
+		return;
+	}
+
+	if (Entries.Num() >= MaxEntries)
+	{
+		// Swap removal does not preserve insertion order, so the oldest entry has to be found by age.
+		int32 L_OldestIndex = 0;
+		for (int32 Index = 1; Index < Entries.Num(); ++Index)
+		{
+			if (Entries[Index].Age > Entries[L_OldestIndex].Age)
+			{
+				L_OldestIndex = Index;
+			}
+		}
+		RemoveEntryAt(L_OldestIndex);
+	}
+
+	FAuraCombatTextEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.TargetActor = TargetActor;
+	Entry.TargetKey = TargetActor;
+	Entry.WorldLocation = TargetActor->GetActorLocation() + WorldOffset;
+	Entry.Amount = Amount;
+	Entry.Text = FString::FromInt(FMath::RoundToInt(FMath::Abs(Amount)));
+
+	OpenEntries.Add(TargetActor, Entries.Num() - 1);
+}
+
+void UAuraCombatTextWidget::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	SetVisibility(ESlateVisibility::HitTestInvisible);
+}
+
+void UAuraCombatTextWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	if (Entries.Num() == 0)
+	{
+		return;
+	}
+
+	APlayerController* PC = GetOwningPlayer();
+	const float L_Lifetime = FMath::Max(Lifetime, AggregationWindow);
+
+	// Iterate backwards so that swap removal only moves entries that were already processed this tick.
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		FAuraCombatTextEntry& Entry = Entries[Index];
+		Entry.Age += InDeltaTime;
+
+		if (Entry.Age >= L_Lifetime)
+		{
+			RemoveEntryAt(Index);
+			continue;
+		}
+
+		if (Entry.bAggregating && Entry.Age >= AggregationWindow)
+		{
+			CloseEntryAt(Index);
+		}
+
+		if (const AActor* L_TargetActor = Entry.TargetActor.Get())
+		{
+			Entry.WorldLocation = L_TargetActor->GetActorLocation() + WorldOffset;
+		}
+
+		FVector2D L_WidgetPosition;
+		Entry.bOnScreen = IsValid(PC) && UWidgetLayoutLibrary::ProjectWorldLocationToWidgetPosition(PC, Entry.WorldLocation, L_WidgetPosition, true);
+		Entry.WidgetPosition = L_WidgetPosition - FVector2D(0.f, RiseSpeed * Entry.Age);
+	}
+
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+int32 UAuraCombatTextWidget::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
+	const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
+	const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const int32 L_MaxLayerId = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+	const int32 R_TextLayerId = L_MaxLayerId + 1;
+	const float L_Lifetime = FMath::Max(Lifetime, AggregationWindow);
+
+	for (const FAuraCombatTextEntry& Entry : Entries)
+	{
+		if (!Entry.bOnScreen)
+		{
+			continue;
+		}
+
+		FLinearColor L_Color = Entry.Amount < 0.f ? DamageColor : HealColor;
+		L_Color.A *= 1.f - Entry.Age / L_Lifetime;
+
+		FSlateDrawElement::MakeText(
+			OutDrawElements,
+			R_TextLayerId,
+			AllottedGeometry.ToPaintGeometry(FVector2D(1.f, 1.f), FSlateLayoutTransform(Entry.WidgetPosition)),
+			Entry.Text,
+			Font,
+			ESlateDrawEffect::None,
+			InWidgetStyle.GetColorAndOpacityTint() * L_Color);
+	}
+
+	return R_TextLayerId;
+}
+
+void UAuraCombatTextWidget::RemoveEntryAt(int32 Index)
+{
+	CloseEntryAt(Index);
+
+	const int32 L_LastIndex = Entries.Num() - 1;
+	if (Index != L_LastIndex)
+	{
+		const FAuraCombatTextEntry& Moved = Entries[L_LastIndex];
+		if (Moved.bAggregating)
+		{
+			GetOpenEntries(Moved.Amount).Add(Moved.TargetKey, Index);
+		}
+	}
+
+	Entries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void UAuraCombatTextWidget::CloseEntryAt(int32 Index)
+{
+	FAuraCombatTextEntry& Entry = Entries[Index];
+	if (Entry.bAggregating)
+	{
+		Entry.bAggregating = false;
+		GetOpenEntries(Entry.Amount).Remove(Entry.TargetKey);
+	}
+}
+
+TMap<TObjectKey<AActor>, int32>& UAuraCombatTextWidget::GetOpenEntries(float Amount)
+{
+	return Amount < 0.f ? OpenDamageEntries : OpenHealEntries;
+}
@@ -0,0 +1,171 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Fonts/SlateFontInfo.h"
+#include "Game/UI/Widget/AuraUserWidget.h"
+#include "AuraCombatTextWidget.generated.h"
+
+/**
+ * @brief A single floating damage or heal number drawn by UAuraCombatTextWidget.
+ *
+ * Entries live in a packed array and carry everything the paint pass needs, so drawing never touches the target actor.
+ */
+struct FAuraCombatTextEntry
+{
+	/** The actor the number floats above. The entry keeps its last known location once the actor is gone. */
+	TWeakObjectPtr<AActor> TargetActor = nullptr;
+
+	/** Key of the target in the open entry maps, stays valid after the actor is destroyed. */
+	TObjectKey<AActor> TargetKey;
+
+	/** World location the number is anchored to. */
+	FVector WorldLocation = FVector::ZeroVector;
+
+	/** Position inside the widget, updated every tick. */
+	FVector2D WidgetPosition = FVector2D::ZeroVector;
+
+	/** Aggregated amount. Negative for damage, positive for healing. */
+	float Amount = 0.f;
+
+	/** Seconds since the entry was created. */
+	float Age = 0.f;
+
+	/** Cached display string, rebuilt only when the amount changes. */
+	FString Text;
+
+	/** Whether the anchor projected onto the screen this tick. */
+	bool bOnScreen = false;
+
+	/** Whether new amounts for the same target are still merged into this entry. */
+	bool bAggregating = true;
+};
+
+/**
+ * @class UAuraCombatTextWidget
+ * @brief HUD-level widget that draws every floating combat number in one paint pass.
+ *
+ * Instead of spawning a UUserWidget or widget component per number, all active numbers are kept in a packed array
+ * and drawn as Slate text elements from NativePaint. Amounts hitting the same target within AggregationWindow
+ * are merged into one number, damage and healing separately, which keeps the element count low in large fights.
+ *
+ * The widget is created and fed by AAuraHUD::AddCombatText.
+ */
+UCLASS()
+class AURA_API UAuraCombatTextWidget : public UAuraUserWidget
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Initializes the default font used to draw the numbers.
+	 */
+	UAuraCombatTextWidget(const FObjectInitializer& ObjectInitializer);
+
+	/**
+	 * @brief Adds an amount above the given target, merging it into an open entry for the same target when possible.
+	 *
+	 * @param TargetActor The actor that took the damage or healing.
+	 * @param Amount The health change. Negative values are damage, positive values are healing.
+	 */
+	void AddCombatText(AActor* TargetActor, float Amount);
+
+protected:
+	virtual void NativeConstruct() override;
+
+	/**
+	 * Ages, expires and re-projects all entries.
+	 */
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
+	/**
+	 * Draws all on-screen entries as text elements on top of the widget's own content.
+	 */
+	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	                          FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
+	                          bool bParentEnabled) const override;
+
+	/**
+	 * Time in seconds during which new amounts for the same target are merged into one number.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "CombatText", meta = (ClampMin = 0.f))
+	float AggregationWindow = 0.25f;
+
+	/**
+	 * Time in seconds a number stays on screen. Never shorter than AggregationWindow.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "CombatText", meta = (ClampMin = 0.1f))
+	float Lifetime = 1.f;
+
+	/**
+	 * Speed in slate units per second at which numbers float upwards.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "CombatText")
+	float RiseSpeed = 60.f;
+
+	/**
+	 * Offset from the target's location the numbers are anchored to.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "CombatText")
+	FVector WorldOffset = FVector(0.f, 0.f, 100.f);
+
+	/**
+	 * Upper bound of simultaneously displayed numbers. The oldest number is dropped when the cap is reached.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "CombatText", meta = (ClampMin = 1))
+	int32 MaxEntries = 128;
+
+	/**
+	 * Font used for all numbers.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "CombatText")
+	FSlateFontInfo Font;
+
+	/**
+	 * Color of damage numbers.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "CombatText")
+	FLinearColor DamageColor = FLinearColor(1.f, 0.2f, 0.1f);
+
+	/**
+	 * Color of healing numbers.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "CombatText")
+	FLinearColor HealColor = FLinearColor(0.2f, 1.f, 0.3f);
+
+private:
+	/**
+	 * Removes the entry at the given index by swapping the last entry into its slot, keeping the open entry maps valid.
+	 *
+	 * @param Index The index of the entry to remove.
+	 */
+	void RemoveEntryAt(int32 Index);
+
+	/**
+	 * Stops merging new amounts into the entry at the given index.
+	 *
+	 * @param Index The index of the entry to close.
+	 */
+	void CloseEntryAt(int32 Index);
+
+	/**
+	 * Returns the map of open entries matching the sign of an amount.
+	 */
+	TMap<TObjectKey<AActor>, int32>& GetOpenEntries(float Amount);
+
+	/**
+	 * All active numbers, packed.
+	 */
+	TArray<FAuraCombatTextEntry> Entries;
+
+	/**
+	 * Index of the damage entry per target that still accepts new amounts.
+	 */
+	TMap<TObjectKey<AActor>, int32> OpenDamageEntries;
+
+	/**
+	 * Index of the healing entry per target that still accepts new amounts.
+	 */
+	TMap<TObjectKey<AActor>, int32> OpenHealEntries;
+};
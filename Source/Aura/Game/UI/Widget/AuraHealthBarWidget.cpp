@@ -0,0 +1,15 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/UI/Widget/AuraHealthBarWidget.h"
+
+void UAuraHealthBarWidget::SetHealthValues(float Health, float MaxHealth)
+{
+	const float L_HealthPercent = MaxHealth > 0.f ? FMath::Clamp(Health / MaxHealth, 0.f, 1.f) : 0.f;
+	HealthValuesSet(Health, MaxHealth, L_HealthPercent);
+}
+
+void UAuraHealthBarWidget::SetHealthBarOwner(AActor* Enemy)
+{
+	HealthBarAssigned(Enemy);
+}
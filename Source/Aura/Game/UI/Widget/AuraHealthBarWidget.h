@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Game/UI/Widget/AuraUserWidget.h"
+#include "AuraHealthBarWidget.generated.h"
+
+/**
+ * @class UAuraHealthBarWidget
+ * @brief Base class for the health bars displayed above enemies.
+ *
+ * Health bars are not bound to the enemy's attribute delegates. UAuraEnemyHealthBarSubsystem collects the changes
+ * and pushes the latest values through SetHealthValues at a rate that depends on the enemy's distance to the camera.
+ * The widget is pooled, so it can be shown for a different enemy every time HealthBarAssigned fires.
+ */
+UCLASS()
+class AURA_API UAuraHealthBarWidget : public UAuraUserWidget
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Pushes the latest health values to the widget.
+	 *
+	 * @param Health The current health of the enemy.
+	 * @param MaxHealth The current maximum health of the enemy.
+	 */
+	void SetHealthValues(float Health, float MaxHealth);
+
+	/**
+	 * @brief Notifies the widget that it now displays a different enemy.
+	 *
+	 * @param Enemy The enemy the widget is attached to.
+	 */
+	void SetHealthBarOwner(AActor* Enemy);
+
+protected:
+	/**
+	 * Blueprint implementable event triggered whenever new health values are pushed to the widget.
+	 *
+	 * @param Health The current health of the enemy.
+	 * @param MaxHealth The current maximum health of the enemy.
+	 * @param HealthPercent Health divided by MaxHealth, 0 when MaxHealth is not initialized yet.
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = "UI|HealthBar")
+	void HealthValuesSet(float Health, float MaxHealth, float HealthPercent);
+
+	/**
+	 * Blueprint implementable event triggered when the pooled widget is attached to another enemy.
+	 * Should reset anything that must not carry over from the previous enemy, like a delayed damage trail.
+	 *
+	 * @param Enemy The enemy the widget is attached to.
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = "UI|HealthBar")
+	void HealthBarAssigned(AActor* Enemy);
+};
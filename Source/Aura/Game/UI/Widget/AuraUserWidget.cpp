@@ -3,8 +3,28 @@
 
 #include "AuraUserWidget.h"
 
+#include "Game/UI/HUD/AuraHUD.h"
+
 void UAuraUserWidget::SetWidgetController(UObject* InWidgetController)
 {
 	WidgetController = InWidgetController;
 	WidgetControllerSet();
 }
+
+void UAuraUserWidget::ReleaseMessageWidget(int32 InMessageSerial)
+{
+	if (InMessageSerial != MessageSerial)
+	{
+		return;
+	}
+
+	if (const APlayerController* PC = GetOwningPlayer(); IsValid(PC))
+	{
+		if (AAuraHUD* AuraHUD = Cast<AAuraHUD>(PC->GetHUD()); IsValid(AuraHUD) && AuraHUD->ReleaseMessageWidget(this))
+		{
+			return;
+		}
+	}
+
+	RemoveFromParent();
+}
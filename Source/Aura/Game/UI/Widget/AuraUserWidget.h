@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Game/UI/Data/UIWidgetRow.h"
 #include "AuraUserWidget.generated.h"
 
 /**
@@ -36,6 +37,42 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SetWidgetController(UObject* InWidgetController);
 
+	/**
+	 * Identifies the message currently displayed by this widget. The HUD changes it every time the widget is handed
+	 * out or returned to the pool, so a callback of an earlier message can tell that the widget moved on.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "UI|Messages")
+	int32 MessageSerial = 0;
+
+	/**
+	 * Returns this message widget to the owning AAuraHUD's message widget pool instead of destroying it.
+	 * Message widgets should call this once their display animation has finished. Widgets that are not pooled by
+	 * the HUD are removed from their parent instead.
+	 *
+	 * @param InMessageSerial The MessageSerial read in MessageWidgetRowSet. When the widget was recycled for another
+	 *        message since, the release is stale and ignored.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UI|Messages")
+	void ReleaseMessageWidget(int32 InMessageSerial);
+
+	/**
+	 * Blueprint implementable event triggered each time the widget is handed out by the HUD's message widget pool.
+	 * Pooled widgets are reused for different messages, so every visual that depends on the row has to be
+	 * (re)initialized here rather than in Construct. MessageSerial already identifies the new message here, keep it
+	 * for the ReleaseMessageWidget call that ends this message.
+	 *
+	 * @param Row The message row this widget should now display.
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = "UI|Messages")
+	void MessageWidgetRowSet(const FUIWidgetRow& Row);
+
+	/**
+	 * Blueprint implementable event triggered when the widget is returned to the HUD's message widget pool.
+	 * Can be used to stop animations or timers that must not keep running while the widget is hidden.
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = "UI|Messages")
+	void MessageWidgetReleased();
+
 protected:
 	/**
 	 * Blueprint implementable event that is triggered after the WidgetController
@@ -5,40 +5,87 @@
 
 #include "Game/AbilitySystem/AttributeSet/AuraAttributeSet.h"
 #include "Game/AbilitySystem/Data/AttributeInfo.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
 
 void UAttributeMenuWidgetController::BindCallbacksToDependencies()
 {
-	UAuraAttributeSet* AS = CastChecked<UAuraAttributeSet>(AttributeSet);
 	check(AttributeInfo);
 
-	for (auto& Pair : AS->TagsToAttributes)
+	UAuraAttributeSet::ForEachTaggedAttribute([this](EAuraGameplayTag AttributeTag, const FGameplayAttribute& Attribute)
 	{
-		AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Pair.Value()).AddLambda(
-			[this, Pair](const FOnAttributeChangeData& Data)
+		AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).AddWeakLambda(this,
+			[this, AttributeTag](const FOnAttributeChangeData& Data)
 				{
-					BroadcastAttributeMenuInfo(Pair.Key, Pair.Value());
+					QueueAttributeMenuInfo(AttributeTag);
 				}
 			);
-	}
+	});
 }
 
 void UAttributeMenuWidgetController::BroadcastInitialValues()
 {
-	UAuraAttributeSet* AS = CastChecked<UAuraAttributeSet>(AttributeSet);
-
 	check(AttributeInfo);
 
-	for (auto& Pair : AS->TagsToAttributes)
+	UAuraAttributeSet::ForEachTaggedAttribute([this](EAuraGameplayTag AttributeTag, const FGameplayAttribute& Attribute)
 	{
-		BroadcastAttributeMenuInfo(Pair.Key, Pair.Value());
-	}
+		AttributeInfoDelegate.Broadcast(MakeAttributeMenuInfo(FAuraGameplayTags::GetTag(AttributeTag), Attribute));
+	});
 }
 
-void UAttributeMenuWidgetController::BroadcastAttributeMenuInfo(const FGameplayTag& AttributeTag,
+FAuraAttributeInfo UAttributeMenuWidgetController::MakeAttributeMenuInfo(const FGameplayTag& AttributeTag,
 	const FGameplayAttribute& Attribute) const
 {
-	FAuraAttributeInfo Info = AttributeInfo->FindAttributeInfoForTag(AttributeTag);
-	Info.AttributeValue = Attribute.GetNumericValue(AttributeSet);
-	AttributeInfoDelegate.Broadcast(Info);
+	FAuraAttributeInfo R_Info = AttributeInfo->FindAttributeInfoForTag(AttributeTag);
+	R_Info.AttributeValue = Attribute.GetNumericValue(AttributeSet);
+	return R_Info;
 }
 
+
+void UAttributeMenuWidgetController::QueueAttributeMenuInfo(EAuraGameplayTag AttributeTag)
+{
+	QueuedAttributeTags.AddTag(AttributeTag);
+
+	if (bRefreshScheduled)
+	{
+		return;
+	}
+
+	if (!IsValid(PlayerController))
+	{
+		BroadcastQueuedAttributeMenuInfo();
+		return;
+	}
+
+	bRefreshScheduled = true;
+	PlayerController->GetWorldTimerManager().SetTimerForNextTick(
+		FTimerDelegate::CreateUObject(this, &UAttributeMenuWidgetController::BroadcastQueuedAttributeMenuInfo));
+}
+
+void UAttributeMenuWidgetController::BroadcastQueuedAttributeMenuInfo()
+{
+	bRefreshScheduled = false;
+
+	TArray<FAuraAttributeInfo> L_Infos;
+	QueuedAttributeTags.ForEachTag([this, &L_Infos](EAuraGameplayTag AttributeTag)
+	{
+		if (const FGameplayAttribute L_Attribute = UAuraAttributeSet::GetAttributeForTag(AttributeTag); L_Attribute.IsValid())
+		{
+			L_Infos.Add(MakeAttributeMenuInfo(FAuraGameplayTags::GetTag(AttributeTag), L_Attribute));
+		}
+	});
+
+	QueuedAttributeTags.Reset();
+
+	if (L_Infos.IsEmpty())
+	{
+		return;
+	}
+
+	// Per entry for the widgets bound to AttributeInfoDelegate, then once for the whole batch.
+	for (const FAuraAttributeInfo& Info : L_Infos)
+	{
+		AttributeInfoDelegate.Broadcast(Info);
+	}
+	AttributeMenuRefreshedDelegate.Broadcast(L_Infos);
+}
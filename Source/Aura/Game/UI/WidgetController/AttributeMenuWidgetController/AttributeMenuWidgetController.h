@@ -4,15 +4,17 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "Game/AuraGameplayTags.h"
+#include "Game/AbilitySystem/Data/AttributeInfo.h"
 #include "Game/UI/WidgetController/AuraWidgetController/AuraWidgetController.h"
 #include "AttributeMenuWidgetController.generated.h"
 
 struct FGameplayAttribute;
 class UAttributeInfo;
 struct FGameplayTag;
-struct FAuraAttributeInfo;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAttributeInfoSignature, const FAuraAttributeInfo&, Info);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAttributeInfosSignature, const TArray<FAuraAttributeInfo>&, Infos);
 
 /**
  * UAttributeMenuWidgetController handles delegation and broadcasting of gameplay attribute information
@@ -30,12 +32,16 @@ public:
 	 * Gameplay Ability System component and the Attribute Menu Widget Controller.
 	 * This method ensures that attribute changes are tracked and corresponding attribute menu updates
 	 * are broadcasted efficiently, leveraging gameplay tags and attributes defined in the associated Attribute Set.
+	 *
+	 * Changes are coalesced and flushed on the next tick: AttributeInfoDelegate is broadcast once per changed attribute,
+	 * however often it changed, followed by a single AttributeMenuRefreshedDelegate carrying every changed attribute.
+	 * A level change that recalculates several attributes in one net update therefore refreshes the menu once.
 	 */
 	virtual void BindCallbacksToDependencies() override;
 
 	/**
 	 * BroadcastInitialValues initializes and broadcasts the initial state of gameplay attribute data from the associated
-	 * AttributeSet to the user interface. It iterates through all attribute mappings in the TagsToAttributes container
+	 * AttributeSet to the user interface. It iterates through all tagged attributes of UAuraAttributeSet
 	 * and invokes the broadcasting functionality using the defined AttributeMenuInfo format.
 	 */
 	virtual void BroadcastInitialValues() override;
@@ -49,6 +55,13 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="GAS|Attributes")
 	FAttributeInfoSignature AttributeInfoDelegate;
 
+	/**
+	 * Broadcast once per tick in which attributes changed, with the information of every changed attribute, after
+	 * AttributeInfoDelegate was broadcast for each of them. Widgets that redraw the whole menu should bind this one.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="GAS|Attributes")
+	FAttributeInfosSignature AttributeMenuRefreshedDelegate;
+
 protected:
 	/**
 	 * AttributeInfo holds the reference to a UAttributeInfo object that provides a mapping
@@ -62,13 +75,35 @@ protected:
 
 private:
 	/**
-	 * Broadcasts updated attribute information for a specific gameplay attribute tag.
-	 * This method retrieves the attribute information associated with the provided tag,
-	 * updates its value using the numeric value from the gameplay attribute,
-	 * and then broadcasts the updated information to all registered listeners.
+	 * Retrieves the attribute information associated with the provided tag and updates its value using the numeric
+	 * value from the gameplay attribute.
+	 *
+	 * @param AttributeTag The gameplay tag that identifies the attribute.
+	 * @param Attribute The gameplay attribute whose value is used to update the attribute information.
+	 * @return The attribute information with the current value.
+	 */
+	FAuraAttributeInfo MakeAttributeMenuInfo(const FGameplayTag& AttributeTag, const FGameplayAttribute& Attribute) const;
+
+	/**
+	 * Queues an attribute for the next refresh and schedules the refresh if needed.
 	 *
-	 * @param AttributeTag The gameplay tag that identifies the attribute to be broadcasted.
-	 * @param Attribute The gameplay attribute whose value will be used to update and broadcast the attribute information.
+	 * @param AttributeTag The Aura-local index of the tag of the changed attribute.
+	 */
+	void QueueAttributeMenuInfo(EAuraGameplayTag AttributeTag);
+
+	/**
+	 * Broadcasts the attribute information of every queued attribute through AttributeInfoDelegate and
+	 * AttributeMenuRefreshedDelegate.
+	 */
+	void BroadcastQueuedAttributeMenuInfo();
+
+	/**
+	 * Tags of the attributes that changed since the last refresh.
+	 */
+	FAuraGameplayTagBitSet QueuedAttributeTags;
+
+	/**
+	 * Whether a refresh is scheduled for the next tick.
 	 */
-	void BroadcastAttributeMenuInfo(const FGameplayTag& AttributeTag, const FGameplayAttribute& Attribute) const;
+	bool bRefreshScheduled = false;
 };
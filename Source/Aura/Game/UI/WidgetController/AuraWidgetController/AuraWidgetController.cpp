@@ -3,6 +3,9 @@
 
 #include "AuraWidgetController.h"
 
+#include "AbilitySystemComponent.h"
+#include "AttributeSet.h"
+
 void UAuraWidgetController::SetWidgetControlParams(const FWidgetControllerParams& WCParams)
 {
 	PlayerController = WCParams.PlayerController;
@@ -19,3 +22,24 @@ void UAuraWidgetController::BroadcastInitialValues()
 void UAuraWidgetController::BindCallbacksToDependencies()
 {
 }
+
+void UAuraWidgetController::UnbindCallbacksFromDependencies()
+{
+	if (!IsValid(AbilitySystemComponent) || !IsValid(AttributeSet))
+	{
+		return;
+	}
+
+	TArray<FGameplayAttribute> L_Attributes;
+	UAttributeSet::GetAttributesFromSetClass(AttributeSet->GetClass(), L_Attributes);
+	for (const FGameplayAttribute& Attribute : L_Attributes)
+	{
+		AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute).RemoveAll(this);
+	}
+}
+
+bool UAuraWidgetController::HasWidgetControlParams(const FWidgetControllerParams& WCParams) const
+{
+	return PlayerController == WCParams.PlayerController && PlayerState == WCParams.PlayerState
+		&& AbilitySystemComponent == WCParams.AbilitySystemComponent && AttributeSet == WCParams.AttributeSet;
+}
@@ -129,6 +129,21 @@ public:
 	 * dependencies propagate correctly to the widget controller.
 	 */
 	virtual void BindCallbacksToDependencies();
+
+	/**
+	 * @brief Removes every callback BindCallbacksToDependencies registered on the current dependencies.
+	 *
+	 * Called before the controller is rebound to new dependencies, e.g. after the player state changed. The base
+	 * version removes the controller from the change delegates of every attribute of AttributeSet.
+	 */
+	virtual void UnbindCallbacksFromDependencies();
+
+	/**
+	 * @brief Returns whether the controller is set up with exactly the given dependencies.
+	 *
+	 * @param WCParams The dependencies to compare with.
+	 */
+	bool HasWidgetControlParams(const FWidgetControllerParams& WCParams) const;
 protected:
 	/**
 	 * @brief A reference to the player controller associated with this widget controller.
@@ -0,0 +1,144 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/UI/WidgetController/AuraWidgetControllerSubsystem/AuraWidgetControllerSubsystem.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Engine/LocalPlayer.h"
+#include "Game/Characters/PlayerState/AuraPlayerState.h"
+#include "Game/UI/HUD/AuraHUD.h"
+#include "Game/UI/WidgetController/AttributeMenuWidgetController/AttributeMenuWidgetController.h"
+#include "Game/UI/WidgetController/AuraWidgetController/AuraWidgetController.h"
+#include "Game/UI/WidgetController/OverlayWidgetController/OverlayWidgetController.h"
+
+UAuraWidgetControllerSubsystem* UAuraWidgetControllerSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		return World->GetSubsystem<UAuraWidgetControllerSubsystem>();
+	}
+
+	return nullptr;
+}
+
+UOverlayWidgetController* UAuraWidgetControllerSubsystem::GetOverlayWidgetController(const UObject* WorldContextObject)
+{
+	FAuraCachedWidgetControllers* Entry = FindOrResolveEntry(WorldContextObject);
+	if (Entry == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (UOverlayWidgetController* L_WidgetController = Entry->OverlayWidgetController.Get())
+	{
+		return L_WidgetController;
+	}
+
+	UOverlayWidgetController* R_WidgetController = Entry->AuraHUD->GetOverlayWidgetController(MakeWidgetControllerParams(*Entry));
+	Entry->OverlayWidgetController = R_WidgetController;
+
+	return R_WidgetController;
+}
+
+UAttributeMenuWidgetController* UAuraWidgetControllerSubsystem::GetAttributeMenuWidgetController(const UObject* WorldContextObject)
+{
+	FAuraCachedWidgetControllers* Entry = FindOrResolveEntry(WorldContextObject);
+	if (Entry == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (UAttributeMenuWidgetController* L_WidgetController = Entry->AttributeMenuWidgetController.Get())
+	{
+		return L_WidgetController;
+	}
+
+	UAttributeMenuWidgetController* R_WidgetController = Entry->AuraHUD->GetAttributeMenuWidgetController(MakeWidgetControllerParams(*Entry));
+	Entry->AttributeMenuWidgetController = R_WidgetController;
+
+	return R_WidgetController;
+}
+
+void UAuraWidgetControllerSubsystem::InvalidateCache(const ULocalPlayer* LocalPlayer)
+{
+	if (LocalPlayer)
+	{
+		CachedControllers.Remove(LocalPlayer);
+	}
+}
+
+bool UAuraWidgetControllerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+ULocalPlayer* UAuraWidgetControllerSubsystem::ResolveLocalPlayer(const UObject* WorldContextObject)
+{
+	if (const UUserWidget* Widget = Cast<UUserWidget>(WorldContextObject))
+	{
+		return Widget->GetOwningLocalPlayer();
+	}
+
+	const APlayerController* PC = Cast<APlayerController>(WorldContextObject);
+	if (const APawn* Pawn = Cast<APawn>(WorldContextObject))
+	{
+		PC = Cast<APlayerController>(Pawn->GetController());
+	}
+	else if (const AHUD* HUD = Cast<AHUD>(WorldContextObject))
+	{
+		PC = HUD->GetOwningPlayerController();
+	}
+
+	if (IsValid(PC))
+	{
+		return PC->GetLocalPlayer();
+	}
+
+	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
+	{
+		return World->GetFirstLocalPlayerFromController();
+	}
+
+	return nullptr;
+}
+
+FAuraCachedWidgetControllers* UAuraWidgetControllerSubsystem::FindOrResolveEntry(const UObject* WorldContextObject)
+{
+	ULocalPlayer* LocalPlayer = ResolveLocalPlayer(WorldContextObject);
+	if (LocalPlayer == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (FAuraCachedWidgetControllers* Entry = CachedControllers.Find(LocalPlayer);
+		Entry && Entry->AuraHUD.IsValid() && Entry->PlayerState.IsValid())
+	{
+		return Entry;
+	}
+
+	// Cache miss, or the HUD / player state went away without an explicit invalidation.
+	if (APlayerController* PC = LocalPlayer->GetPlayerController(GetWorld()); IsValid(PC))
+	{
+		if (AAuraHUD* AuraHUD = Cast<AAuraHUD>(PC->GetHUD()))
+		{
+			if (AAuraPlayerState* PS = PC->GetPlayerState<AAuraPlayerState>(); IsValid(PS))
+			{
+				FAuraCachedWidgetControllers& Entry = CachedControllers.FindOrAdd(LocalPlayer);
+				Entry = FAuraCachedWidgetControllers();
+				Entry.PlayerController = PC;
+				Entry.AuraHUD = AuraHUD;
+				Entry.PlayerState = PS;
+
+				return &Entry;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+FWidgetControllerParams UAuraWidgetControllerSubsystem::MakeWidgetControllerParams(const FAuraCachedWidgetControllers& Entry)
+{
+	AAuraPlayerState* PS = Entry.PlayerState.Get();
+	return FWidgetControllerParams(Entry.PlayerController.Get(), PS, PS->GetAbilitySystemComponent(), PS->GetAttributeSet());
+}
@@ -0,0 +1,126 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraWidgetControllerSubsystem.generated.h"
+
+class AAuraHUD;
+class AAuraPlayerState;
+class ULocalPlayer;
+class UAttributeMenuWidgetController;
+class UOverlayWidgetController;
+struct FWidgetControllerParams;
+
+/**
+ * @brief The resolved widget controller dependencies of a single local player.
+ *
+ * An entry is filled the first time a widget asks for one of its controllers and is reused until the owning
+ * player controller reports a possession or player state change. All references are weak so that a stale entry
+ * can never keep the HUD, the player state or the controllers alive.
+ */
+struct FAuraCachedWidgetControllers
+{
+	TWeakObjectPtr<APlayerController> PlayerController = nullptr;
+
+	TWeakObjectPtr<AAuraHUD> AuraHUD = nullptr;
+
+	TWeakObjectPtr<AAuraPlayerState> PlayerState = nullptr;
+
+	TWeakObjectPtr<UOverlayWidgetController> OverlayWidgetController = nullptr;
+
+	TWeakObjectPtr<UAttributeMenuWidgetController> AttributeMenuWidgetController = nullptr;
+};
+
+/**
+ * @class UAuraWidgetControllerSubsystem
+ * @brief Per-world cache of the widget controllers owned by each local player's HUD.
+ *
+ * Widgets request their controllers through UAuraAbilitySystemLibrary very frequently. Resolving a controller
+ * from scratch means finding the player controller, casting its HUD and player state and rebuilding the widget
+ * controller params on every call. This subsystem resolves those dependencies once per local player and turns
+ * every following request into a single map lookup. The owning player is taken from the world context object
+ * (a widget, pawn, player controller or HUD), so split-screen players each get their own controllers.
+ *
+ * AAuraPlayerController invalidates its entry whenever its pawn or player state changes.
+ */
+UCLASS()
+class AURA_API UAuraWidgetControllerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Retrieves the subsystem of the world the given context object lives in.
+	 *
+	 * @param WorldContextObject Any object that can provide a world.
+	 * @return The subsystem instance, or nullptr if the context has no game world.
+	 */
+	static UAuraWidgetControllerSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * @brief Returns the overlay widget controller of the local player that owns the context object.
+	 *
+	 * @param WorldContextObject A widget, pawn, player controller or HUD identifying the local player.
+	 *        Any other object falls back to the first local player of its world.
+	 * @return The cached overlay widget controller, or nullptr if the player is not fully initialized yet.
+	 */
+	UOverlayWidgetController* GetOverlayWidgetController(const UObject* WorldContextObject);
+
+	/**
+	 * @brief Returns the attribute menu widget controller of the local player that owns the context object.
+	 *
+	 * @param WorldContextObject A widget, pawn, player controller or HUD identifying the local player.
+	 *        Any other object falls back to the first local player of its world.
+	 * @return The cached attribute menu widget controller, or nullptr if the player is not fully initialized yet.
+	 */
+	UAttributeMenuWidgetController* GetAttributeMenuWidgetController(const UObject* WorldContextObject);
+
+	/**
+	 * @brief Drops the cached entry of the given local player.
+	 *
+	 * Called when the player controller possesses a new pawn or receives a new player state, so that the
+	 * next request resolves its dependencies again. The HUD keeps its controllers and rebinds them to the newly
+	 * resolved player state on that request, see AAuraHUD::GetOverlayWidgetController.
+	 *
+	 * @param LocalPlayer The local player whose cached controllers are no longer valid.
+	 */
+	void InvalidateCache(const ULocalPlayer* LocalPlayer);
+
+protected:
+	/**
+	 * Restricts the subsystem to game and PIE worlds, editor preview worlds never host a HUD.
+	 */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * @brief Finds the local player that owns the given context object.
+	 *
+	 * @param WorldContextObject The object passed in from Blueprint.
+	 * @return The owning local player, or the first local player of the context's world if no owner can be found.
+	 */
+	static ULocalPlayer* ResolveLocalPlayer(const UObject* WorldContextObject);
+
+	/**
+	 * @brief Returns the cached entry of the context's local player, resolving it first if needed.
+	 *
+	 * @param WorldContextObject The object passed in from Blueprint.
+	 * @return The entry, or nullptr if the local player has no Aura HUD or player state yet.
+	 */
+	FAuraCachedWidgetControllers* FindOrResolveEntry(const UObject* WorldContextObject);
+
+	/**
+	 * @brief Builds the widget controller params from an already resolved entry.
+	 *
+	 * @param Entry A valid cache entry.
+	 * @return The params used by AAuraHUD to initialize a widget controller.
+	 */
+	static FWidgetControllerParams MakeWidgetControllerParams(const FAuraCachedWidgetControllers& Entry);
+
+	/**
+	 * Resolved widget controllers keyed by local player.
+	 */
+	TMap<TObjectKey<ULocalPlayer>, FAuraCachedWidgetControllers> CachedControllers;
+};
@@ -5,6 +5,9 @@
 
 #include "Aura/Game/AbilitySystem/AuraAbilitySystemComponent.h"
 #include "Aura/Game/AbilitySystem/AttributeSet/AuraAttributeSet.h"
+#include "Game/AuraAssetManager.h"
+#include "Game/AuraGameplayTags.h"
+#include "Game/Characters/PlayerState/AuraPlayerState.h"
 #include "Kismet/KismetSystemLibrary.h"
 
 void UOverlayWidgetController::BroadcastInitialValues()
@@ -23,6 +26,11 @@ void UOverlayWidgetController::BroadcastInitialValues()
 
 	OnManaChanged.Broadcast(L_Mana);
 	OnMaxManaChanged.Broadcast(L_MaxMana);
+
+	if (const AAuraPlayerState* L_AuraPlayerState = Cast<AAuraPlayerState>(PlayerState); IsValid(L_AuraPlayerState))
+	{
+		OnPlayerLevelChanged.Broadcast(L_AuraPlayerState->GetPLayerLevel());
+	}
 }
 
 void UOverlayWidgetController::BindCallbacksToDependencies()
@@ -34,47 +42,150 @@ void UOverlayWidgetController::BindCallbacksToDependencies()
 	const FGameplayAttribute L_ManaAttributeData = L_AuraAttributeSet->GetManaAttribute();
 	const FGameplayAttribute L_MaxManaAttributeData = L_AuraAttributeSet->GetMaxManaAttribute();
 
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(L_HealthAttributeData).AddLambda(
+	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(L_HealthAttributeData).AddWeakLambda(this,
 		[this](const FOnAttributeChangeData& Data)
 		{
 			OnHealthChanged.Broadcast(Data.NewValue);
 		}
 	);
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(L_MaxHealthAttributeData).AddLambda(
+	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(L_MaxHealthAttributeData).AddWeakLambda(this,
 		[this](const FOnAttributeChangeData& Data)
 		{
 			OnMaxHealthChanged.Broadcast(Data.NewValue);
 		}
 	);
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(L_ManaAttributeData).AddLambda(
+	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(L_ManaAttributeData).AddWeakLambda(this,
 		[this](const FOnAttributeChangeData& Data)
 		{
 			OnManaChanged.Broadcast(Data.NewValue);
 		}
 	);
-	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(L_MaxManaAttributeData).AddLambda(
+	AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(L_MaxManaAttributeData).AddWeakLambda(this,
 		[this](const FOnAttributeChangeData& Data)
 		{
 			OnMaxManaChanged.Broadcast(Data.NewValue);
 		}
 	);
 
-	Cast<UAuraAbilitySystemComponent>(AbilitySystemComponent)->EffectAssetTags.AddLambda(
-			[this](const FGameplayTagContainer& AssetTags)
+	if (AAuraPlayerState* L_AuraPlayerState = Cast<AAuraPlayerState>(PlayerState); IsValid(L_AuraPlayerState))
+	{
+		L_AuraPlayerState->OnLevelChanged.AddWeakLambda(this, [this](int32 NewLevel)
 		{
-			for (const FGameplayTag& Tag  : AssetTags)
-			{
-				// "Message.HealthPotion".MatchesTag("Message") will return True, "Message".MatchesTag("Message.HealthPotion") will return False
-				FGameplayTag MessageTag = FGameplayTag::RequestGameplayTag(FName("Message"));
-
-				if (bool IsMatching = Tag.MatchesTag(MessageTag); IsMatching)
-				{
-					if (FUIWidgetRow* Row = GetDataTableRowByTag<FUIWidgetRow>(MessageWidgetDataTable, Tag))
-					{
-						MessageWidgetRowDelegate.Broadcast(*Row);
-					}
-				}
-			}		
+			OnPlayerLevelChanged.Broadcast(NewLevel);
+		});
+	}
+
+	// Only "Message" tags and their children, e.g. "Message.HealthPotion", are routed here.
+	MessageSubscriptionHandle = CastChecked<UAuraAbilitySystemComponent>(AbilitySystemComponent)->SubscribeEffectAssetTags(EAuraGameplayTag::Message,
+		FEffectAssetTagRouted::FDelegate::CreateUObject(this, &UOverlayWidgetController::BroadcastMessageWidgetRow));
+
+	ResidentMessageRows.Empty(FMath::Max(MaxResidentMessageRows, 1));
+
+	const TArray<FSoftObjectPath> L_AssetsToLoad = { MessageWidgetDataTable.ToSoftObjectPath() };
+	MessageWidgetDataTableHandle = UAuraAssetManager::Get().LoadUIAssetsAsync(L_AssetsToLoad,
+		FStreamableDelegate::CreateUObject(this, &UOverlayWidgetController::OnMessageWidgetDataTableLoaded));
+}
+
+void UOverlayWidgetController::UnbindCallbacksFromDependencies()
+{
+	Super::UnbindCallbacksFromDependencies();
+
+	if (AAuraPlayerState* L_AuraPlayerState = Cast<AAuraPlayerState>(PlayerState); IsValid(L_AuraPlayerState))
+	{
+		L_AuraPlayerState->OnLevelChanged.RemoveAll(this);
+	}
+
+	if (UAuraAbilitySystemComponent* L_AuraASC = Cast<UAuraAbilitySystemComponent>(AbilitySystemComponent); IsValid(L_AuraASC))
+	{
+		L_AuraASC->UnsubscribeEffectAssetTags(EAuraGameplayTag::Message, MessageSubscriptionHandle);
+	}
+	MessageSubscriptionHandle.Reset();
+}
+
+void UOverlayWidgetController::PrefetchMessage(const FGameplayTag& MessageTag)
+{
+	if (MessageWidgetDataTable.IsNull())
+	{
+		return;
+	}
+
+	if (MessageWidgetDataTable.Get() == nullptr)
+	{
+		PendingPrefetchTags.AddUnique(MessageTag);
+		return;
+	}
+
+	RequestMessageRowAssets(MessageTag, false);
+}
+
+void UOverlayWidgetController::BroadcastMessageWidgetRow(const FGameplayTag& MessageTag)
+{
+	if (MessageWidgetDataTable.IsNull())
+	{
+		return;
+	}
+
+	if (MessageWidgetDataTable.Get() == nullptr)
+	{
+		PendingMessageTags.Add(MessageTag);
+		return;
+	}
+
+	RequestMessageRowAssets(MessageTag, true);
+}
+
+void UOverlayWidgetController::RequestMessageRowAssets(const FGameplayTag& MessageTag, bool bBroadcastWhenResident)
+{
+	const FUIWidgetRow* Row = GetDataTableRowByTag<FUIWidgetRow>(MessageWidgetDataTable.Get(), MessageTag);
+	if (Row == nullptr)
+	{
+		return;
+	}
+
+	const FName L_RowName = MessageTag.GetTagName();
+	if (const TSharedPtr<FStreamableHandle>* L_Handle = ResidentMessageRows.FindAndTouch(L_RowName);
+		L_Handle && (!L_Handle->IsValid() || (*L_Handle)->HasLoadCompleted()))
+	{
+		if (bBroadcastWhenResident)
+		{
+			MessageWidgetRowDelegate.Broadcast(*Row);
 		}
-	);
+		return;
+	}
+
+	// Either a miss or a load that is still in flight. A second request for the same assets is cheap and
+	// lets this call get its own completion callback.
+	FStreamableDelegate L_OnLoaded;
+	if (bBroadcastWhenResident)
+	{
+		L_OnLoaded = FStreamableDelegate::CreateWeakLambda(this, [this, L_Row = *Row]()
+		{
+			MessageWidgetRowDelegate.Broadcast(L_Row);
+		});
+	}
+
+	const TArray<FSoftObjectPath> L_AssetsToLoad = { Row->MessageWidget.ToSoftObjectPath(), Row->Image.ToSoftObjectPath() };
+	ResidentMessageRows.Add(L_RowName, UAuraAssetManager::Get().LoadUIAssetsAsync(L_AssetsToLoad, MoveTemp(L_OnLoaded)));
+}
+
+void UOverlayWidgetController::OnMessageWidgetDataTableLoaded()
+{
+	if (MessageWidgetDataTable.Get() == nullptr)
+	{
+		PendingMessageTags.Reset();
+		PendingPrefetchTags.Reset();
+		return;
+	}
+
+	TArray<FGameplayTag> L_PendingPrefetchTags = MoveTemp(PendingPrefetchTags);
+	for (const FGameplayTag& MessageTag : L_PendingPrefetchTags)
+	{
+		RequestMessageRowAssets(MessageTag, false);
+	}
+
+	TArray<FGameplayTag> L_PendingMessageTags = MoveTemp(PendingMessageTags);
+	for (const FGameplayTag& MessageTag : L_PendingMessageTags)
+	{
+		RequestMessageRowAssets(MessageTag, true);
+	}
 }
@@ -4,57 +4,16 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "Containers/LruCache.h"
+#include "Aura/Game/UI/Data/UIWidgetRow.h"
 #include "Aura/Game/UI/Widget/AuraUserWidget.h"
 #include "Aura/Game/UI/WidgetController/AuraWidgetController/AuraWidgetController.h"
 #include "OverlayWidgetController.generated.h"
 
-/**
- * Represents a row in a data table containing user interface widget data.
- * This structure is used to define UI elements associated with specific gameplay tags.
- */
-USTRUCT()
-struct FUIWidgetRow : public FTableRowBase
-{
-	GENERATED_BODY()
-
-	/**
-	 * A gameplay tag that serves as an identifier or category for the associated UI message.
-	 * This variable is editable in the editor and is read-only in blueprints.
-	 * Primarily used in FUIWidgetRow to tag specific rows with a unique identifier
-	 * that can correspond to a specific type of UI message or action.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly)
-	FGameplayTag MessageTag = FGameplayTag();
-
-	/**
-	 * A localized text variable used to store displayable text data.
-	 * This variable is editable in the property editor and can be read-only within Blueprints.
-	 * It is primarily designed for user-facing UI widgets to display specific messages or information.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly)
-	FText Message = FText();
-
-	/**
-	 * A property that holds a class reference to a subclass of UAuraUserWidget.
-	 * The widget represented by this property can be used to display messages
-	 * or other UI elements within the context of a gameplay framework.
-	 *
-	 * This property is editable in both the editor and through blueprints,
-	 * but can only be read in blueprints. The exact class must derive from UAuraUserWidget.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly)
-	TSubclassOf<class UAuraUserWidget> MessageWidget;
-
-	/**
-	 * A UTexture2D object representing an image associated with the widget.
-	 * This property is editable in the editor and read-only in Blueprints.
-	 * It is initialized to nullptr and can be assigned a valid texture to display or use as needed.
-	 */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly)
-	UTexture2D* Image = nullptr;
-};
+struct FStreamableHandle;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAttributeChangedSignature, float, NewValue);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerStatChangedSignature, int32, NewValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMessageWidgetRowSignature, FUIWidgetRow, Row);
 
 /**
@@ -105,9 +64,17 @@ public:
 	 * - OnManaChanged: Broadcasts when the mana attribute changes.
 	 * - OnMaxManaChanged: Broadcasts when the max mana attribute changes.
 	 * - MessageWidgetRowDelegate: Broadcasts a UI widget row based on matching gameplay tags.
+	 *
+	 * Also starts streaming in MessageWidgetDataTable. Messages received before the table is loaded are queued
+	 * and broadcast once it is.
 	 */
 	virtual void BindCallbacksToDependencies() override;
 
+	/**
+	 * @brief Removes the attribute, level and message callbacks registered by BindCallbacksToDependencies.
+	 */
+	virtual void UnbindCallbacksFromDependencies() override;
+
 	/**
 	 * Delegate to handle the event when the Health attribute value changes.
 	 * This variable is bound to the Health attribute changes in the underlying system
@@ -161,6 +128,12 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="GAS|Attributes")
 	FOnAttributeChangedSignature OnMaxManaChanged;
 
+	/**
+	 * @brief Broadcast once per level change of the player, after the level dependent attributes are updated.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="GAS|Level")
+	FOnPlayerStatChangedSignature OnPlayerLevelChanged;
+
 	/**
 	 * @brief A delegate used to handle the broadcasting of message widget row data.
 	 *
@@ -169,9 +142,22 @@ public:
 	 * events or updates tied to UI elements, to listening or bound components.
 	 *
 	 * The delegate is dynamically assignable in Blueprint and categorized under "GAS|Attributes".
+	 * Listeners should display the row through AAuraHUD::AcquireMessageWidget rather than creating a new widget,
+	 * so that message widgets are pooled.
 	 */
 	UPROPERTY(BlueprintAssignable, Category="GAS|Attributes")
 	FMessageWidgetRowSignature MessageWidgetRowDelegate;
+
+	/**
+	 * @brief Starts streaming in the widget class and image of a message row before the message is shown.
+	 *
+	 * A hint for messages that are likely to appear soon, e.g. when a potion comes into view. The row takes a slot
+	 * in the resident row cache like a displayed one. Prefetching before the message table is loaded is deferred.
+	 *
+	 * @param MessageTag The tag of the message row to prefetch.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "WidgetData")
+	void PrefetchMessage(const FGameplayTag& MessageTag);
 protected:
 	/**
 	 * @brief A reference to a data table containing configurations for message widgets.
@@ -184,13 +170,44 @@ protected:
 	 * can interpret and utilize for display or functionality purposes. It may be accessed
 	 * to retrieve configuration data dynamically during runtime.
 	 *
+	 * The table is a soft reference so that it is not loaded with the map. It is streamed in when the
+	 * controller binds its callbacks.
+	 *
 	 * @remark This property is marked as editable in defaults and readable in Blueprints.
 	 *
 	 * @category WidgetData
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "WidgetData")
-	TObjectPtr<UDataTable> MessageWidgetDataTable = nullptr;
-	
+	TSoftObjectPtr<UDataTable> MessageWidgetDataTable = nullptr;
+
+	/**
+	 * @brief Maximum number of message rows whose widget class and image are kept resident.
+	 *
+	 * When a row beyond this count is used, the least recently used row releases its assets.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "WidgetData", meta = (ClampMin = 1))
+	int32 MaxResidentMessageRows = 8;
+
+	/**
+	 * Broadcasts the message row of a tag, or queues the tag while MessageWidgetDataTable is still loading.
+	 *
+	 * @param MessageTag A tag matching "Message".
+	 */
+	void BroadcastMessageWidgetRow(const FGameplayTag& MessageTag);
+
+	/**
+	 * @brief Makes the assets of a message row resident, optionally broadcasting the row once they are.
+	 *
+	 * @param MessageTag The tag of the message row.
+	 * @param bBroadcastWhenResident Whether to broadcast the row through MessageWidgetRowDelegate once its assets are loaded.
+	 */
+	void RequestMessageRowAssets(const FGameplayTag& MessageTag, bool bBroadcastWhenResident);
+
+	/**
+	 * Broadcasts the messages queued while MessageWidgetDataTable was loading.
+	 */
+	void OnMessageWidgetDataTableLoaded();
+
 	template<typename T>
 	/**
 	 * Retrieves a row from a data table corresponding to the specified gameplay tag.
@@ -204,4 +221,31 @@ protected:
 	{
 		return DataTable->FindRow<T>(Tag.GetTagName(), TEXT(""));
 	};
+
+private:
+	/**
+	 * Keeps MessageWidgetDataTable resident while the controller exists.
+	 */
+	TSharedPtr<FStreamableHandle> MessageWidgetDataTableHandle;
+
+	/**
+	 * Handle of the "Message" subscription on the ability system component.
+	 */
+	FDelegateHandle MessageSubscriptionHandle;
+
+	/**
+	 * Message tags received before MessageWidgetDataTable finished loading, in order of arrival.
+	 */
+	TArray<FGameplayTag> PendingMessageTags;
+
+	/**
+	 * Message tags prefetched before MessageWidgetDataTable finished loading.
+	 */
+	TArray<FGameplayTag> PendingPrefetchTags;
+
+	/**
+	 * Streamable handles keeping the assets of the most recently used message rows resident, keyed by row name.
+	 * Evicting a handle lets the garbage collector unload the row's assets once no widget uses them anymore.
+	 */
+	TLruCache<FName, TSharedPtr<FStreamableHandle>> ResidentMessageRows;
 };
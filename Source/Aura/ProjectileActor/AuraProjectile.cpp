@@ -4,6 +4,8 @@
 #include "ProjectileActor/AuraProjectile.h"
 
 #include "Components/SphereComponent.h"
+#include "Game/AuraAssetManager.h"
+#include "Game/Networking/AuraNetRelevancySubsystem.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 
 AAuraProjectile::AAuraProjectile()
@@ -25,6 +27,33 @@ AAuraProjectile::AAuraProjectile()
 	ProjectileMovement->ProjectileGravityScale = 0.f;
 }
 
+FPrimaryAssetId AAuraProjectile::GetPrimaryAssetId() const
+{
+	if (HasAnyFlags(RF_ClassDefaultObject) && !GetClass()->HasAnyClassFlags(CLASS_Native))
+	{
+		return FPrimaryAssetId(UAuraAssetManager::ProjectileAssetType, FPackageName::GetShortFName(GetOutermost()->GetFName()));
+	}
+
+	return Super::GetPrimaryAssetId();
+}
+
+bool AAuraProjectile::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	if (bAlwaysRelevant || IsOwnedBy(ViewTarget) || IsOwnedBy(RealViewer) || this == ViewTarget || ViewTarget == GetInstigator())
+	{
+		return true;
+	}
+
+	bool bRelevant = false;
+	if (const UAuraNetRelevancySubsystem* RelevancySubsystem = GetWorld()->GetSubsystem<UAuraNetRelevancySubsystem>();
+		IsValid(RelevancySubsystem) && RelevancySubsystem->IsRelevantForViewer(RealViewer, GetActorLocation(), bRelevant))
+	{
+		return bRelevant;
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
+
 void AAuraProjectile::BeginPlay()
 {
 	Super::BeginPlay();
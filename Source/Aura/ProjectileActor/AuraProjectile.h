@@ -17,6 +17,17 @@ class AURA_API AAuraProjectile : public AActor
 public:	
 	AAuraProjectile();
 
+	/**
+	 * Identifies blueprint projectiles as primary assets of type UAuraAssetManager::ProjectileAssetType.
+	 */
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	/**
+	 * Restricts relevancy to connections whose top-down view contains the projectile, see UAuraNetRelevancySubsystem.
+	 * The projectile stays relevant to the connection that fired it.
+	 */
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Projectile")
 	TObjectPtr<UProjectileMovementComponent> ProjectileMovement = nullptr;
 